@@ -12,3 +12,5 @@
 #include "freddy/dd/kfdd.hpp"    // Kronecker functional decision diagram
 #include "freddy/dd/phdd.hpp"    // power hybrid decision diagram
 #include "freddy/expansion.hpp"  // expansion types
+#include "freddy/netlist.hpp"    // AIGER/BLIF frontend
+#include "freddy/order.hpp"      // static variable ordering
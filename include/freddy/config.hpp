@@ -4,6 +4,7 @@
 // Includes
 // *********************************************************************************************************************
 
+#include <chrono>       // std::chrono::milliseconds
 #include <cstddef>      // std::size_t
 #include <cstdint>      // std::uint32_t
 #include <optional>     // std::nullopt
@@ -28,6 +29,25 @@ static_assert(std::is_integral_v<var_index> && std::is_unsigned_v<var_index>, "v
 // Types
 // =====================================================================================================================
 
+enum struct reorder_method : std::uint8_t  // for dynamic (automatic) variable reordering
+{
+    NONE,       // disabled
+    SIFT,       // sifting of each variable (group)
+    SIFT_CONV,  // sifting repeated until the relative gain of a pass falls below min_reorder_gain
+    SYMM_SIFT,  // sifting in which symmetric variables are moved together (until no new symmetries are found)
+    WINDOW2,    // permutations of two adjacent variables (groups) until no improvement
+    WINDOW3,    // permutations of three adjacent variables (groups) until no improvement
+    WINDOW4,    // permutations of four adjacent variables (groups) until no improvement
+    EXACT,      // minimum by dynamic programming for up to 20 variables (groups), sifting otherwise
+    DTL_SIFT    // sifting including decomposition types (for DD types supporting them such as KFDDs)
+};
+
+enum struct var_mapping : std::uint8_t  // for transferring DDs between managers
+{
+    INDEX,  // variable x replaces variable x
+    LABEL   // variables with the same label replace each other
+};
+
 struct config final
 {
     std::size_t utable_size_hint{1'679};  // minimum capacity of each UT per DD level
@@ -38,6 +58,18 @@ struct config final
 
     float max_node_growth{1.2f};  // permitted node growth factor during variable reordering
 
+    std::optional<std::size_t> max_swaps{std::nullopt};  // level exchanges per variable reordering (unlimited if unset)
+
+    std::optional<std::chrono::milliseconds> max_reorder_time{std::nullopt};  // time budget per variable reordering
+
+    float min_reorder_gain{0.01f};  // relative size reduction required to repeat a converging sifting pass
+
+    reorder_method dyn_reorder{reorder_method::NONE};  // reordering triggered at safe points due to node growth
+
+    std::size_t reorder_thresh{4'004};  // minimum #nodes (alive) from which dynamic reordering is triggered
+
+    float reorder_growth{2.0f};  // factor by which the #nodes must grow after a dynamic reordering to trigger it again
+
     std::optional<std::size_t> heap_mem_limit{std::nullopt};  // heap usage in bytes before GC (auto-estimated if unset)
 };
 
@@ -4,16 +4,17 @@
 // Includes
 // *********************************************************************************************************************
 
-#include "freddy/config.hpp"                 // config
-#include "freddy/detail/common.hpp"          // detail::hashable
-#include "freddy/detail/edge.hpp"            // detail::edge
-#include "freddy/detail/manager.hpp"         // detail::manager
-#include "freddy/detail/node.hpp"            // detail::edge_ptr
-#include "freddy/detail/operation/mul.hpp"   // detail::mul
-#include "freddy/detail/operation/plus.hpp"  // detail::plus
-#include "freddy/expansion.hpp"              // expansion::S
-
-#include <boost/algorithm/string.hpp>  // boost::replace_all
+#include "freddy/config.hpp"                     // config
+#include "freddy/detail/common.hpp"              // detail::hashable
+#include "freddy/detail/edge.hpp"                // detail::edge
+#include "freddy/detail/manager.hpp"             // detail::manager
+#include "freddy/detail/node.hpp"                // detail::edge_ptr
+#include "freddy/detail/operation/extremum.hpp"  // detail::extremum
+#include "freddy/detail/operation/ite.hpp"       // detail::ite
+#include "freddy/detail/operation/mul.hpp"       // detail::mul
+#include "freddy/detail/operation/plus.hpp"      // detail::plus
+#include "freddy/expansion.hpp"                  // expansion::S
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4702)
@@ -29,8 +30,11 @@
 #include <cmath>        // std::isinf
 #include <concepts>     // std::floating_point
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
+#include <memory>       // std::make_unique
 #include <ostream>      // std::ostream
-#include <sstream>      // std::ostringstream
+#include <span>         // std::span
 #include <stdexcept>    // std::overflow_error
 #include <string>       // std::string
 #include <string_view>  // std::string_view
@@ -193,6 +197,12 @@ class add final  // algebraic decision diagram (multi-terminal binary decision d
 
     [[nodiscard]] auto has_const(NValue) const;
 
+    [[nodiscard]] auto min() const;
+
+    [[nodiscard]] auto max() const;
+
+    [[nodiscard]] auto argmin() const;  // assignment leading to the minimum (false for variables off the path)
+
     [[nodiscard]] auto is_essential(var_index) const noexcept;
 
     [[nodiscard]] auto compose(var_index, add const&) const;
@@ -208,14 +218,7 @@ class add final  // algebraic decision diagram (multi-terminal binary decision d
   private:
     friend add_manager<NValue>;
 
-    // wrapper is controlled by its ADD manager
-    add(detail::edge_ptr<bool, NValue> f, add_manager<NValue>* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    add(detail::edge_ptr<bool, NValue>, add_manager<NValue>*);  // wrapper is controlled by its ADD manager
 
     detail::edge_ptr<bool, NValue> f;  // ADD handle
 
@@ -267,6 +270,23 @@ class add_manager final : public detail::manager<bool, NValue>
         return add{manager::constant(2), this};
     }
 
+    // sum of all ADDs, whereby operands on the same variables are added first (see detail::combine_all)
+    auto sum_all(std::span<add<NValue> const> const fs)
+    {
+        return detail::combine_all(
+            fs, zero(), [](add<NValue> f, add<NValue> const& g) { return f + g; },
+            [](add<NValue> const&) { return false; }, [this](add<NValue> const& h) { return manager::support(h.f); });
+    }
+
+    auto product_all(std::span<add<NValue> const> const fs)
+    {
+        auto const z = zero();
+        return detail::combine_all(
+            fs, one(), [](add<NValue> f, add<NValue> const& g) { return f * g; },
+            [&z](add<NValue> const& h) { return h == z; },
+            [this](add<NValue> const& h) { return manager::support(h.f); });
+    }
+
     [[nodiscard]] auto size(std::vector<add<NValue>> const& fs) const
     {
         return manager::size(transform(fs));
@@ -284,12 +304,42 @@ class add_manager final : public detail::manager<bool, NValue>
     {
         assert(outputs.empty() ? true : outputs.size() == fs.size());
 
-        std::ostringstream oss;
-        manager::dump_dot(transform(fs), outputs, oss);
+        manager::dump_dot(transform(fs), outputs, os);
+    }
 
-        auto dot = oss.str();
-        boost::replace_all(dot, "label=\" 0 \"]", "]");  // as no different edge weights are used
-        os << dot;
+    auto dump_edge_list(std::vector<add<NValue>> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<add<NValue>> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
+
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<add<NValue>> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return add<NValue>{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the ADDs in dst, which can be another ADD manager or a manager of another arithmetic DD type
+    template <typename Manager>
+    auto transfer(std::vector<add<NValue>> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::template transfer<false>(transform(fs), dst, m);
+    }
+
+    // value of each DD for assignment 64k + j, where bit j of as[x][k] is the value of variable x
+    [[nodiscard]] auto eval_batch(std::vector<add<NValue>> const& fs,
+                                  std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        return manager::eval_batch(
+            transform(fs), as, [this](auto const& w, auto const& val) { return add_manager::agg(w, val); },
+            [this](auto const& val1, auto const& val2) { return add_manager::merge(val1, val2); });
     }
 
   private:
@@ -316,6 +366,41 @@ class add_manager final : public detail::manager<bool, NValue>
         return fs;
     }
 
+    auto extremum(edge_ptr const& f, bool const max) -> NValue
+    {
+        assert(f);
+
+        if (f->is_const())
+        {
+            return f->ch()->value();
+        }
+
+        detail::extremum op{f, max};
+        if (auto const* const entry = this->cached(op))
+        {
+            return entry->get_result();
+        }
+
+        auto const hi = extremum(f->ch()->br().hi, max);
+        auto const lo = extremum(f->ch()->br().lo, max);
+        op.set_result(max ? std::max(hi, lo) : std::min(hi, lo));
+        return this->cache(std::move(op))->get_result();
+    }
+
+    auto argmin(edge_ptr f)
+    {
+        assert(f);
+
+        std::vector<bool> as(this->var_count());
+        while (!f->is_const())
+        {  // descend along cached minima
+            auto const& br = f->ch()->br();
+            as[br.x] = extremum(br.hi, false) < extremum(br.lo, false);
+            f = as[br.x] ? br.hi : br.lo;
+        }
+        return as;
+    }
+
     auto neg(edge_ptr const& f)
     {
         assert(f);
@@ -383,6 +468,57 @@ class add_manager final : public detail::manager<bool, NValue>
         return sub(plus(f, g), mul(f, g));
     }
 
+    // NOLINTNEXTLINE(performance-unnecessary-value-param) because simplifications may change pointers
+    auto ite(edge_ptr f, edge_ptr g, edge_ptr h) -> edge_ptr override  // f is expected to be 0/1-valued
+    {
+        assert(f);
+        assert(g);
+        assert(h);
+
+        // terminal cases, which also hold for other values of f due to ite(f, g, h) = h + f(g - h)
+        if (f == manager::constant(0))
+        {
+            return h;
+        }
+        if (f == manager::constant(1) || g == h)
+        {
+            return g;
+        }
+        if (h == manager::constant(0))
+        {
+            return mul(f, g);
+        }
+        if (g == manager::constant(0))
+        {
+            return sub(h, mul(f, h));
+        }
+        if (f->is_const())
+        {
+            return plus(h, mul(f, sub(g, h)));
+        }
+
+        detail::ite op{f, g, h};
+        if (auto const* const entry = this->cached(op))
+        {
+            return entry->get_result();
+        }
+
+        auto const x = f->ch()->br().x == this->top_var(f, g) ? this->top_var(f, h) : this->top_var(g, h);
+
+        op.set_result(branch(x, ite(this->cof(f, x, true), this->cof(g, x, true), this->cof(h, x, true)),
+                             ite(this->cof(f, x, false), this->cof(g, x, false), this->cof(h, x, false))));
+        return this->cache(std::move(op))->get_result();
+    }
+
+    [[nodiscard]] auto is_normal(NValue const& val) const noexcept -> bool override
+    {
+        if constexpr (std::floating_point<NValue>)
+        {
+            return !std::isnan(val);  // as NaN breaks the unique table
+        }
+        return true;
+    }
+
     [[nodiscard]] auto merge(NValue const& val1, [[maybe_unused]] NValue const& val2) const noexcept -> NValue override
     {
         return val1 * 0;  // as no Davio expansion is used
@@ -490,8 +626,29 @@ class add_manager final : public detail::manager<bool, NValue>
     {
         return false;
     }
+
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<add_manager<NValue>>(config());
+    }
+
+    [[nodiscard]] auto weighted() const noexcept -> bool override
+    {
+        return false;  // as no different edge weights are used
+    }
 };
 
+template <detail::hashable NValue>
+inline add<NValue>::add(detail::edge_ptr<bool, NValue> f, add_manager<NValue>* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
 template <detail::hashable NValue>
 inline auto add<NValue>::operator-() const
 {
@@ -507,6 +664,7 @@ inline auto add<NValue>::operator*=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->mul(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -518,6 +676,7 @@ inline auto add<NValue>::operator+=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->plus(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -529,6 +688,7 @@ inline auto add<NValue>::operator-=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->sub(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -548,6 +708,7 @@ inline auto add<NValue>::operator&=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -559,6 +720,7 @@ inline auto add<NValue>::operator|=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -570,6 +732,7 @@ inline auto add<NValue>::operator^=(add const& rhs) -> add&
     assert(mgr == rhs.mgr);
 
     f = mgr->antiv(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -657,6 +820,30 @@ inline auto add<NValue>::has_const(NValue const c) const
     return mgr->has_const(f, c);
 }
 
+template <detail::hashable NValue>
+inline auto add<NValue>::min() const
+{
+    assert(mgr);
+
+    return mgr->extremum(f, false);
+}
+
+template <detail::hashable NValue>
+inline auto add<NValue>::max() const
+{
+    assert(mgr);
+
+    return mgr->extremum(f, true);
+}
+
+template <detail::hashable NValue>
+inline auto add<NValue>::argmin() const
+{
+    assert(mgr);
+
+    return mgr->argmin(f);
+}
+
 template <detail::hashable NValue>
 inline auto add<NValue>::is_essential(var_index const x) const noexcept
 {
@@ -5,20 +5,38 @@
 // *********************************************************************************************************************
 
 #include "freddy/config.hpp"                     // config
+#include "freddy/dd/bdd_sampler.hpp"             // bdd_sampler
+#include "freddy/dd/compiled_bdd.hpp"            // compiled_bdd
+#include "freddy/dd/isop_cover.hpp"              // isop_cover
+#include "freddy/detail/common.hpp"              // detail::write_bin
+#include "freddy/detail/cube.hpp"                // detail::cube_range
+#include "freddy/detail/frozen.hpp"              // detail::frozen_header
 #include "freddy/detail/manager.hpp"             // detail::manager
 #include "freddy/detail/node.hpp"                // detail::edge_ptr
 #include "freddy/detail/operation/antiv.hpp"     // detail::antiv
 #include "freddy/detail/operation/conj.hpp"      // detail::conj
+#include "freddy/detail/operation/isop.hpp"      // detail::isop
 #include "freddy/detail/operation/ite.hpp"       // detail::ite
 #include "freddy/detail/operation/sharpsat.hpp"  // detail::sharpsat
 #include "freddy/expansion.hpp"                  // expansion::S
 
+#include <boost/unordered/unordered_flat_map.hpp>  // boost::unordered_flat_map
+
 #include <algorithm>    // std::ranges::transform
 #include <array>        // std::array
 #include <cassert>      // assert
+#include <cstddef>      // std::size_t
 #include <cstdint>      // std::int32_t
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
+#include <limits>       // std::numeric_limits
+#include <memory>       // std::make_unique
 #include <ostream>      // std::ostream
+#include <random>       // std::uniform_random_bit_generator
+#include <span>         // std::span
+#include <ranges>       // std::views::take
+#include <stdexcept>    // std::length_error
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 #include <utility>      // std::forward
@@ -165,19 +183,22 @@ class bdd final  // binary decision diagram
 
     [[nodiscard]] auto sharpsat() const;
 
+    template <std::uniform_random_bit_generator Rng>
+    [[nodiscard]] auto sample(Rng&, std::size_t) const;  // uniformly distributed solutions
+
+    // cheapest solution and its cost, where costs[x] are the costs of the literals ~x and x
+    [[nodiscard]] auto min_cost_assignment(std::vector<std::pair<double, double>> const&) const;
+
+    [[nodiscard]] auto isop() const;  // irredundant sum-of-products cover
+
+    [[nodiscard]] auto cubes() const;  // lazy enumeration of the disjoint cubes covering the satisfying assignments
+
     auto dump_dot(std::ostream& = std::cout) const;
 
   private:
     friend bdd_manager;
 
-    // wrapper is controlled by its BDD manager
-    bdd(detail::edge_ptr<bool, bool> f, bdd_manager* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    bdd(detail::edge_ptr<bool, bool>, bdd_manager*);  // wrapper is controlled by its BDD manager
 
     detail::edge_ptr<bool, bool> f;  // BDD handle
 
@@ -212,6 +233,11 @@ class bdd_manager final : public detail::manager<bool, bool>
         return bdd{constant(1), this};
     }
 
+    // conjunction of all BDDs, whereby operands on the same variables are combined first (see detail::combine_all)
+    auto conj_all(std::span<bdd const>) -> bdd;
+
+    auto disj_all(std::span<bdd const>) -> bdd;
+
     [[nodiscard]] auto size(std::vector<bdd> const& fs) const
     {
         return manager::size(transform(fs));
@@ -232,6 +258,163 @@ class bdd_manager final : public detail::manager<bool, bool>
         manager::dump_dot(transform(fs), outputs, os);
     }
 
+    auto dump_edge_list(std::vector<bdd> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<bdd> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
+
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<bdd> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return bdd{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the BDDs in dst, which can be another BDD manager (e.g., with a different order) or a manager of any
+    // other DD type
+    template <typename Manager>
+    auto transfer(std::vector<bdd> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::transfer<true>(transform(fs), dst, m);
+    }
+
+    // bit j of as[x][k] is the value of variable x in assignment 64k + j, and so is bit j of word k of each result
+    [[nodiscard]] auto eval_batch(std::vector<bdd> const& fs, std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        return manager::eval_batch(transform(fs), as, [](bool const c) { return c; });
+    }
+
+    // flattens f into a branch program for fast point queries (see compiled_bdd.hpp)
+    [[nodiscard]] auto compile(bdd const& f) const
+    {
+        auto const [post, ids] = flatten(f.f);
+        auto enc = [&ids](edge_ptr const& e) {
+            return ids.at(e->ch().get()) << 1u | static_cast<std::uint32_t>(e->weight());
+        };
+
+        std::vector<compiled_bdd::step> nodes;
+        nodes.reserve(post.size() + 1);
+        nodes.push_back({});  // 0-leaf
+        for (auto const* const v : post | std::views::reverse)
+        {
+            nodes.push_back({.x = v->br().x, .succ = {enc(v->br().lo), enc(v->br().hi)}});
+        }
+        return compiled_bdd{std::move(nodes), enc(f.f), static_cast<var_index>(var_count())};
+    }
+
+    // precomputes the densities of f for drawing uniformly distributed solutions (see bdd_sampler.hpp)
+    [[nodiscard]] auto sampler(bdd const& f) const
+    {
+        if (f.f == constant(0))
+        {
+            throw std::invalid_argument{"An unsatisfiable BDD cannot be sampled."};
+        }
+
+        auto const [post, ids] = flatten(f.f);
+        auto enc = [&ids](edge_ptr const& e) {
+            return ids.at(e->ch().get()) << 1u | static_cast<std::uint32_t>(e->weight());
+        };
+
+        // densities of each node and its complement, which are both computed bottom-up because 1 - d cancels
+        std::vector<std::array<double, 2>> dens(post.size() + 1);
+        dens[0] = {0, 1};  // 0-leaf
+        auto density = [&dens, &enc](edge_ptr const& e, std::uint32_t const par) {
+            auto const g = enc(e);
+            return dens[g >> 1u][(g ^ par) & 1u];
+        };
+
+        std::vector<bdd_sampler::step> nodes(post.size() + 1);
+        for (auto const* const v : post)
+        {  // successors first
+            auto const& br = v->br();
+            auto const i = ids.at(v);
+            for (auto par = 0u; par < 2; ++par)
+            {
+                auto const dh = density(br.hi, par);
+                auto const dl = density(br.lo, par);
+                dens[i][par] = (dh + dl) / 2;
+                nodes[i].p[par] = dh / (dh + dl);
+            }
+            nodes[i].x = br.x;
+            nodes[i].succ = {enc(br.lo), enc(br.hi)};
+        }
+        return bdd_sampler{std::move(nodes), enc(f.f), static_cast<var_index>(var_count())};
+    }
+
+    // Minato-Morreale ISOP of an incompletely specified function lower <= f <= upper, which returns f and its cover
+    auto isop(bdd const& lower, bdd const& upper)
+    {
+        assert(lower.mgr == this);
+        assert(upper.mgr == this);
+
+        if (conj(lower.f, complement(upper.f)) != constant(0))
+        {
+            throw std::invalid_argument{"The lower bound must imply the upper bound."};
+        }
+
+        auto [g, c] = isop(lower.f, upper.f);
+        return std::pair{bdd{std::move(g), this}, isop_cover{std::move(c), static_cast<var_index>(var_count())}};
+    }
+
+    // writes an immutable image of the BDDs that can be memory-mapped by frozen_bdd_image (see frozen_bdd.hpp)
+    auto freeze(std::vector<bdd> const& fs, std::ostream& os) const
+    {
+        auto const lvls = levelize(transform(fs));
+        auto const count = std::ranges::fold_left(lvls | std::views::take(var_count()), 1uz,
+                                                  [](auto const sum, auto const& lvl) { return sum + lvl.size(); });
+        constexpr auto max = std::numeric_limits<std::uint32_t>::max();
+        if (count > max >> 1u || fs.size() > max)
+        {  // edges are encoded by 32 bits
+            throw std::length_error{"BDDs are too large to be frozen."};
+        }
+
+        boost::unordered_flat_map<node const*, std::uint32_t> ids;
+        ids.reserve(count);
+        ids.emplace(constant(0)->ch().get(), 0);  // the only leaf
+        for (auto const& lvl : lvls | std::views::take(var_count()) | std::views::reverse)
+        {  // successors receive smaller indices
+            for (auto const* const v : lvl)
+            {
+                ids.emplace(v, static_cast<std::uint32_t>(ids.size()));
+            }
+        }
+        auto enc = [&ids](edge_ptr const& e) {
+            return ids.at(e->ch().get()) << 1u | static_cast<std::uint32_t>(e->weight());
+        };
+
+        detail::write_bin(os, detail::frozen_header{.magic = detail::frozen_magic,
+                                                    .version = detail::frozen_version,
+                                                    .endianness = detail::frozen_endianness,
+                                                    .var_count = static_cast<std::uint32_t>(var_count()),
+                                                    .root_count = static_cast<std::uint32_t>(fs.size()),
+                                                    .node_count = static_cast<std::uint32_t>(count),
+                                                    .reserved = 0});
+        for (auto const x : order())
+        {
+            detail::write_bin(os, x);
+        }
+        for (auto const& f : fs)
+        {
+            detail::write_bin(os, enc(f.f));
+        }
+        detail::write_bin(os, detail::frozen_node{});  // 0-leaf
+        for (auto const& lvl : lvls | std::views::take(var_count()) | std::views::reverse)
+        {
+            for (auto const* const v : lvl)
+            {
+                auto const& br = v->br();
+                detail::write_bin(os, detail::frozen_node{.x = br.x, .hi = enc(br.hi), .lo = enc(br.lo)});
+            }
+        }
+    }
+
   private:
     friend bdd;
 
@@ -292,6 +475,143 @@ class bdd_manager final : public detail::manager<bool, bool>
         return cache(std::move(op))->get_result();
     }
 
+    [[nodiscard]] auto flatten(edge_ptr const& f) const
+        -> std::pair<std::vector<node const*>, boost::unordered_flat_map<node const*, std::uint32_t>>
+    {  // nodes of f in postorder and their indices in reverse postorder, which is topological
+        std::vector<node const*> post;  // successors first
+        boost::unordered_flat_map<node const*, std::uint32_t> ids;
+        ids.emplace(constant(0)->ch().get(), 0);
+        std::vector<std::pair<node const*, bool>> stack{{f->ch().get(), false}};
+        while (!stack.empty())
+        {  // depth-first, so that a path mostly stays within a few cache lines
+            auto const [v, expanded] = stack.back();
+            stack.pop_back();
+            if (expanded)
+            {
+                post.push_back(v);
+                continue;
+            }
+            if (!ids.emplace(v, 0).second)
+            {
+                continue;
+            }
+            stack.emplace_back(v, true);
+            stack.emplace_back(v->br().hi->ch().get(), false);
+            stack.emplace_back(v->br().lo->ch().get(), false);
+        }
+        if (post.size() >= std::numeric_limits<std::uint32_t>::max() >> 1u)
+        {  // edges are encoded by 32 bits
+            throw std::length_error{"BDD is too large to be flattened."};
+        }
+
+        for (auto i = 0uz; i < post.size(); ++i)
+        {  // successors receive greater indices
+            ids[post[i]] = static_cast<std::uint32_t>(post.size() - i);
+        }
+        return {std::move(post), std::move(ids)};
+    }
+
+    [[nodiscard]] auto min_cost_assignment(edge_ptr const& f, std::vector<std::pair<double, double>> const& costs) const
+    {
+        assert(f);
+
+        if (costs.size() != var_count())
+        {
+            throw std::invalid_argument{"There must be one pair of literal costs per variable."};
+        }
+        if (f == constant(0))
+        {
+            throw std::invalid_argument{"An unsatisfiable BDD has no minimum-cost assignment."};
+        }
+
+        // Variables off a path are set to their cheaper literal, so each node only has to account for the additional
+        // costs of the other literal. The cheapest completion of a node is stored for both parities of the path.
+        auto extra = [&costs](var_index const x, bool const a) {
+            auto const& [c0, c1] = costs[x];
+            return a ? std::max(c1 - c0, 0.0) : std::max(c0 - c1, 0.0);
+        };
+        constexpr auto inf = std::numeric_limits<double>::infinity();
+        boost::unordered_flat_map<node const*, std::array<double, 2>> memo;
+        memo.emplace(constant(0)->ch().get(), std::array{inf, 0.0});  // only the complemented 0-leaf is a solution
+        auto best = [&memo](edge_ptr const& e, bool const m) { return memo.at(e->ch().get())[m != e->weight()]; };
+        auto trav = [&](auto const& self, node const* const v) -> void {  // single bottom-up pass
+            if (memo.contains(v))
+            {
+                return;
+            }
+
+            auto const& br = v->br();
+            self(self, br.hi->ch().get());
+            self(self, br.lo->ch().get());
+            std::array<double, 2> res{};
+            for (auto const m : {false, true})
+            {
+                res[m] = std::min(extra(br.x, false) + best(br.lo, m), extra(br.x, true) + best(br.hi, m));
+            }
+            memo.emplace(v, res);
+        };
+        trav(trav, f->ch().get());
+
+        std::vector<bool> as(var_count());
+        auto cost = best(f, false);
+        for (var_index x = 0; x < var_count(); ++x)
+        {
+            as[x] = costs[x].second < costs[x].first;
+            cost += std::min(costs[x].first, costs[x].second);
+        }
+        auto g = f;
+        auto m = g->weight();
+        while (!g->is_const())
+        {  // follow the cheapest completion
+            auto const& br = g->ch()->br();
+            as[br.x] = extra(br.x, true) + best(br.hi, m) < extra(br.x, false) + best(br.lo, m);
+            g = as[br.x] ? br.hi : br.lo;
+            m = m != g->weight();
+        }
+        return std::pair{cost, std::move(as)};
+    }
+
+    auto isop(edge_ptr const& l, edge_ptr const& u) -> std::pair<edge_ptr, detail::cover_ptr>
+    {
+        assert(l);
+        assert(u);
+
+        if (l == constant(0))
+        {
+            return {constant(0), nullptr};
+        }
+        if (u == constant(1))
+        {
+            return {constant(1), detail::cover_node::taut()};
+        }
+
+        detail::isop op{l, u};
+        if (auto const* const entry = cached(op))
+        {
+            return entry->get_result();
+        }
+
+        auto const x = top_var(l, u);
+        auto const l0 = cof(l, x, false), l1 = cof(l, x, true);
+        auto const u0 = cof(u, x, false), u1 = cof(u, x, true);
+        auto [g0, c0] = isop(conj(l0, complement(u1)), u0);  // cubes requiring ~x
+        auto [g1, c1] = isop(conj(l1, complement(u0)), u1);  // cubes requiring x
+        auto const [gd, cd] = isop(disj(conj(l0, complement(g0)), conj(l1, complement(g1))), conj(u0, u1));
+
+        auto c = c0 || c1 ? std::make_shared<detail::cover_node const>(x, std::move(c0), std::move(c1), cd) : cd;
+        op.set_result(disj(branch(x, std::move(g1), std::move(g0)), gd), std::move(c));
+        return cache(std::move(op))->get_result();
+    }
+
+    [[nodiscard]] auto cubes(edge_ptr const& f) const
+    {
+        assert(f);
+
+        return detail::cube_range{
+            f, var_count(), [](edge_ptr const& g) { return std::pair{g->ch()->br().lo, g->ch()->br().hi}; },
+            [](edge_ptr const&, bool const m) { return m; }};  // complemented 0-leaf
+    }
+
     auto sharpsat(edge_ptr const& f)
     {
         assert(f);
@@ -504,6 +824,11 @@ class bdd_manager final : public detail::manager<bool, bool>
         return cache(std::move(op))->get_result();
     }
 
+    [[nodiscard]] auto is_normal(bool const& val) const noexcept -> bool override
+    {
+        return !val;  // as 1 is the complemented 0-leaf
+    }
+
     [[nodiscard]] auto merge(bool const& val1, bool const& val2) const noexcept -> bool override
     {
         return val1 != val2;
@@ -523,8 +848,23 @@ class bdd_manager final : public detail::manager<bool, bool>
     {
         return false;  // means a regular (non-complemented) edge
     }
+
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<bdd_manager>(config());
+    }
 };
 
+inline bdd::bdd(detail::edge_ptr<bool, bool> f, bdd_manager* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
 inline auto bdd::operator~() const
 {
     assert(mgr);
@@ -538,6 +878,7 @@ inline auto bdd::operator&=(bdd const& rhs) -> bdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -548,6 +889,7 @@ inline auto bdd::operator|=(bdd const& rhs) -> bdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -558,6 +900,7 @@ inline auto bdd::operator^=(bdd const& rhs) -> bdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->antiv(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -664,6 +1007,35 @@ inline auto bdd::sharpsat() const
     return mgr->sharpsat(f);
 }
 
+template <std::uniform_random_bit_generator Rng>
+inline auto bdd::sample(Rng& rng, std::size_t const n) const
+{
+    assert(mgr);
+
+    return mgr->sampler(*this).sample(rng, n);
+}
+
+inline auto bdd::min_cost_assignment(std::vector<std::pair<double, double>> const& costs) const
+{
+    assert(mgr);
+
+    return mgr->min_cost_assignment(f, costs);
+}
+
+inline auto bdd::isop() const
+{
+    assert(mgr);
+
+    return mgr->isop(*this, *this).second;
+}
+
+inline auto bdd::cubes() const
+{
+    assert(mgr);
+
+    return mgr->cubes(f);
+}
+
 inline auto bdd::dump_dot(std::ostream& os) const
 {
     assert(mgr);
@@ -671,4 +1043,18 @@ inline auto bdd::dump_dot(std::ostream& os) const
     mgr->dump_dot({*this}, {}, os);
 }
 
+inline auto bdd_manager::conj_all(std::span<bdd const> const fs) -> bdd
+{
+    return detail::combine_all(
+        fs, one(), [](bdd const& f, bdd const& g) { return f & g; }, [](bdd const& h) { return h.is_zero(); },
+        [this](bdd const& h) { return support(h.f); });
+}
+
+inline auto bdd_manager::disj_all(std::span<bdd const> const fs) -> bdd
+{
+    return detail::combine_all(
+        fs, zero(), [](bdd const& f, bdd const& g) { return f | g; }, [](bdd const& h) { return h.is_one(); },
+        [this](bdd const& h) { return support(h.f); });
+}
+
 }  // namespace freddy
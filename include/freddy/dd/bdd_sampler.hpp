@@ -0,0 +1,155 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"         // var_index
+#include "freddy/detail/common.hpp"  // detail::parallel_for
+
+#include <algorithm>  // std::min
+#include <array>      // std::array
+#include <cassert>    // assert
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint32_t
+#include <random>     // std::uniform_random_bit_generator
+#include <utility>    // std::move
+#include <vector>     // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Forwards
+// =====================================================================================================================
+
+class bdd_manager;
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// Uniform sampler of the satisfying assignments of a BDD (see bdd_manager::sampler). It is laid out like compiled_bdd,
+// but each node also stores the probability of its high successor, which is the high cofactor's share of the node's
+// density (fraction of satisfying assignments). A sample is thus drawn by a single descent in which variables off the
+// path are fair coin flips. The densities of a node and of its complement are both computed bottom-up, since deriving
+// one from the other as 1 - d cancels for sparse functions. They are doubles, however, i.e., they underflow once the
+// fraction of solutions drops below about 2^-1022. The sampler is immutable and can be shared by threads.
+class bdd_sampler final
+{
+  public:
+    template <std::uniform_random_bit_generator Rng>
+    [[nodiscard]] auto sample(Rng& rng) const
+    {
+        std::vector<bool> as(vars);
+        draw(rng, as);
+        return as;
+    }
+
+    template <std::uniform_random_bit_generator Rng>
+    [[nodiscard]] auto sample(Rng& rng, std::size_t const n) const
+    {
+        std::vector<std::vector<bool>> as(n, std::vector<bool>(vars));
+        for (auto& a : as)
+        {
+            draw(rng, a);
+        }
+        return as;
+    }
+
+    // draws n samples in chunks, whereby each chunk has its own generator seeded by (seed, chunk index) so that the
+    // result does not depend on the number of threads
+    [[nodiscard]] auto sample_parallel(std::size_t const n, std::uint64_t const seed) const
+    {
+        constexpr auto chunk = 4'096uz;
+
+        std::vector<std::vector<bool>> as(n, std::vector<bool>(vars));
+        if (n > 0)
+        {
+            detail::parallel_for(0uz, (n + chunk - 1) / chunk, [&as, n, seed, this](std::size_t const i) {
+                std::seed_seq seq{seed, std::uint64_t{i}};
+                std::mt19937_64 rng{seq};
+                for (auto j = i * chunk; j < std::min(n, (i + 1) * chunk); ++j)
+                {
+                    draw(rng, as[j]);
+                }
+            });
+        }
+        return as;
+    }
+
+    [[nodiscard]] auto var_count() const noexcept
+    {
+        return vars;
+    }
+
+    [[nodiscard]] auto node_count() const noexcept -> std::size_t  // including the 0-leaf
+    {
+        return nodes.size();
+    }
+
+  private:
+    friend bdd_manager;
+
+    struct step final
+    {
+        std::uint32_t x;  // variable index
+
+        std::array<std::uint32_t, 2> succ;  // encoded edges to the low and the high successor
+
+        std::array<double, 2> p;  // probability of the high successor if the path parity is even/odd
+    };
+
+    bdd_sampler(std::vector<step> nodes, std::uint32_t const root, var_index const vars) :
+            nodes{std::move(nodes)},
+            root{root},
+            vars{vars}
+    {
+        assert(this->root != 0);  // there is a solution
+    }
+
+    template <std::uniform_random_bit_generator Rng>
+    auto draw(Rng& rng, std::vector<bool>& as) const -> void
+    {
+        assert(as.size() == vars);
+
+        std::uniform_int_distribution<std::uint64_t> bits;
+        std::uint64_t buf{};
+        for (auto x = 0uz; x < vars; ++x)
+        {  // variables that do not occur on the path are don't cares
+            if (x % 64 == 0)
+            {
+                buf = bits(rng);
+            }
+            as[x] = ((buf >> (x % 64)) & 1u) != 0;
+        }
+
+        std::uniform_real_distribution<double> coin;
+        auto f = root;
+        auto par = f & 1u;
+        while (f >> 1u != 0)
+        {
+            assert(f >> 1u < nodes.size());
+
+            auto const& v = nodes[f >> 1u];
+            auto const a = coin(rng) < v.p[par];
+            as[v.x] = a;
+            f = v.succ[static_cast<std::size_t>(a)];
+            par ^= f & 1u;
+        }
+
+        assert(par == 1);  // the complemented 0-leaf has been reached
+    }
+
+    std::vector<step> nodes;  // 0-leaf first, followed by the nodes in topological order
+
+    std::uint32_t root{};  // encoded edge
+
+    var_index vars{};
+};
+
+}  // namespace freddy
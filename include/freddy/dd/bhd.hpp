@@ -5,14 +5,14 @@
 // *********************************************************************************************************************
 
 #include "freddy/config.hpp"                 // config
+#include "freddy/detail/common.hpp"          // detail::out_buffer
+#include "freddy/detail/cube.hpp"            // detail::cube_range
 #include "freddy/detail/manager.hpp"         // detail::manager
 #include "freddy/detail/node.hpp"            // detail::edge_ptr
 #include "freddy/detail/operation/conj.hpp"  // detail::conj
 #include "freddy/detail/operation/repl.hpp"  // detail::repl
 #include "freddy/expansion.hpp"              // expansion::S
 
-#include <boost/algorithm/string.hpp>  // boost::replace_all
-
 #include <algorithm>    // std::ranges::transform
 #include <array>        // std::array
 #include <cassert>      // assert
@@ -20,9 +20,11 @@
 #include <cstdint>      // std::uint8_t
 #include <functional>   // std::function
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
+#include <memory>       // std::make_unique
 #include <optional>     // std::optional
 #include <ostream>      // std::ostream
-#include <sstream>      // std::ostringstream
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 #include <utility>      // std::pair
@@ -175,6 +177,8 @@ class bhd final  // binary hybrid diagram between BDD and SAT
 
     [[nodiscard]] auto sat_solutions() const;  // one existing solution per path
 
+    [[nodiscard]] auto cubes() const;  // lazy counterpart of sat_solutions with don't cares
+
     [[nodiscard]] auto unit_clauses() const;  // for each expansion path to solve subfunctions via a SAT solver
 
     auto dump_dot(std::ostream& = std::cout) const;
@@ -182,14 +186,7 @@ class bhd final  // binary hybrid diagram between BDD and SAT
   private:
     friend bhd_manager;
 
-    // wrapper is controlled by its BHD manager
-    bhd(detail::edge_ptr<bool, bool> f, bhd_manager* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    bhd(detail::edge_ptr<bool, bool>, bhd_manager*);  // wrapper is controlled by its BHD manager
 
     detail::edge_ptr<bool, bool> f;  // BHD handle
 
@@ -270,14 +267,51 @@ class bhd_manager final : public detail::manager<bool, bool>
     {
         assert(outputs.empty() ? true : outputs.size() == fs.size());
 
-        // to highlight the expansion node labeled with "EXP" that marks the end of all expansion paths
-        std::ostringstream oss;
-        manager::dump_dot(transform(fs), outputs, oss);
+        manager::dump_dot(transform(fs), outputs, os);
+    }
+
+    auto dump_edge_list(std::vector<bhd> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<bhd> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
 
-        auto dot = oss.str();
-        boost::replace_all(dot, "[shape=box,style=filled,color=chocolate,fontcolor=white,label=\"1\"]",
-                           "[shape=triangle,style=filled,color=darkviolet,fontcolor=white,label=\"EXP\"]");
-        os << dot;
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<bhd> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return bhd{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the BHDs in dst, which can be a manager of any other DD type as long as they do not contain expansion
+    // nodes
+    template <typename Manager>
+    auto transfer(std::vector<bhd> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::transfer<true>(transform(fs), dst, m);
+    }
+
+    // packed values (bit j of as[x][k] is the value of variable x in assignment 64k + j) and the assignments for which
+    // the expansion node is reached, i.e., whose values cannot be determined (see eval)
+    [[nodiscard]] auto eval_batch(std::vector<bhd> const& fs, std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        auto const gs = transform(fs);
+        auto vals = manager::eval_batch(gs, as, [](bool const c) { return c; });
+        auto exps = manager::eval_batch<false>(gs, as, [](bool const c) { return c; });
+        for (auto i = 0uz; i < vals.size(); ++i)
+        {
+            for (auto k = 0uz; k < vals[i].size(); ++k)
+            {
+                vals[i][k] &= ~exps[i][k];
+            }
+        }
+        return std::pair{std::move(vals), std::move(exps)};
     }
 
   private:
@@ -353,6 +387,15 @@ class bhd_manager final : public detail::manager<bool, bool>
         sat_solutions(f->ch()->br().hi, comb(m, f->ch()->br().hi->weight()), path, sols);
     }
 
+    [[nodiscard]] auto cubes(edge_ptr const& f) const
+    {
+        assert(f);
+
+        return detail::cube_range{
+            f, var_count(), [](edge_ptr const& g) { return std::pair{g->ch()->br().lo, g->ch()->br().hi}; },
+            [](edge_ptr const& g, bool const m) { return m && !g->ch()->value(); }};  // expansion is no solution
+    }
+
     [[nodiscard]] auto sat_solutions(edge_ptr const& f) const
     {
         assert(f);
@@ -597,6 +640,16 @@ class bhd_manager final : public detail::manager<bool, bool>
         return complement(conj(complement(f), complement(g)));
     }
 
+    auto dump_dot_const(bool const& c, detail::out_buffer& out) const -> void override
+    {
+        if (c)
+        {  // to highlight the expansion node that marks the end of all expansion paths
+            out << R"(shape=triangle,style=filled,color=darkviolet,fontcolor=white,label="EXP")";
+            return;
+        }
+        manager::dump_dot_const(c, out);
+    }
+
     [[nodiscard]] auto merge(bool const& val1, bool const& val2) const noexcept -> bool override
     {
         return val1 != val2;
@@ -617,6 +670,11 @@ class bhd_manager final : public detail::manager<bool, bool>
         return false;
     }
 
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<bhd_manager>(config());
+    }
+
     // heuristic technique that can be used to reduce BDD sizes during conjunction
     std::function<edge_ptr(edge_ptr const&, edge_ptr const&, var_index)> heur{
         [this](auto const& f, auto const& g, auto const x) { return no_heur(f, g, x); }};
@@ -625,6 +683,16 @@ class bhd_manager final : public detail::manager<bool, bool>
     std::size_t exp_thresh{};
 };
 
+inline bhd::bhd(detail::edge_ptr<bool, bool> f, bhd_manager* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
 inline auto bhd::operator~() const
 {
     assert(mgr);
@@ -638,6 +706,7 @@ inline auto bhd::operator&=(bhd const& rhs) -> bhd&
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -648,6 +717,7 @@ inline auto bhd::operator|=(bhd const& rhs) -> bhd&
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -658,6 +728,7 @@ inline auto bhd::operator^=(bhd const& rhs) -> bhd&
     assert(mgr == rhs.mgr);
 
     f = mgr->plus(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -783,6 +854,13 @@ inline auto bhd::sat_solutions() const
     return mgr->sat_solutions(f);
 }
 
+inline auto bhd::cubes() const
+{
+    assert(mgr);
+
+    return mgr->cubes(f);
+}
+
 inline auto bhd::unit_clauses() const
 {
     assert(mgr);
@@ -5,11 +5,14 @@
 // *********************************************************************************************************************
 
 #include "freddy/config.hpp"                 // config
+#include "freddy/detail/common.hpp"          // detail::combine_all
 #include "freddy/detail/manager.hpp"         // detail::manager
 #include "freddy/detail/node.hpp"            // detail::edge_ptr
+#include "freddy/detail/operation/ite.hpp"   // detail::ite
 #include "freddy/detail/operation/mul.hpp"   // detail::mul
 #include "freddy/detail/operation/plus.hpp"  // detail::plus
 #include "freddy/expansion.hpp"              // expansion::pD
+#include "freddy/wide_int.hpp"               // wide_int
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -25,12 +28,17 @@
 #include <cassert>      // assert
 #include <cmath>        // std::abs
 #include <concepts>     // std::integral
+#include <cstddef>      // std::size_t
 #include <cstdint>      // std::int64_t
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
 #include <limits>       // std::numeric_limits
+#include <memory>       // std::make_unique
 #include <numeric>      // std::gcd
 #include <ostream>      // std::ostream
 #include <ranges>       // std::views::iota
+#include <span>         // std::span
 #include <string>       // std::string
 #include <string_view>  // hash
 #include <type_traits>  // std::is_signed_v
@@ -63,7 +71,11 @@ namespace freddy
 // Forwards
 // =====================================================================================================================
 
-class bmd_manager;
+template <detail::hashable Int>
+class basic_bmd;
+
+template <detail::hashable Int>
+class basic_bmd_manager;
 
 // =====================================================================================================================
 // Aliases
@@ -77,87 +89,99 @@ static_assert(std::is_integral_v<boost::safe_numerics::base_type<bmd_int>::type>
                   std::is_signed_v<boost::safe_numerics::base_type<bmd_int>::type>,
               "bmd_int must be signed");
 
+using bmd = basic_bmd<bmd_int>;
+
+using bmd_manager = basic_bmd_manager<bmd_int>;
+
+#ifdef __SIZEOF_INT128__
+// for multipliers whose word-level weights exceed bmd_int, i.e., beyond 32 bits
+using wide_bmd = basic_bmd<wide_int>;
+
+using wide_bmd_manager = basic_bmd_manager<wide_int>;
+#endif
+
 // =====================================================================================================================
 // Types
 // =====================================================================================================================
 
-class bmd final  // (multiplicative) binary moment diagram
+template <detail::hashable Int>  // edge weight and node value
+class basic_bmd final  // (multiplicative) binary moment diagram
 {
   public:
-    bmd() noexcept = default;  // enable default BMD construction for compatibility with standard containers
+    basic_bmd() noexcept = default;  // enable default BMD construction for compatibility with standard containers
 
     auto operator-() const;
 
-    auto operator*=(bmd const&) -> bmd&;
+    auto operator*=(basic_bmd const&) -> basic_bmd&;
 
-    auto operator+=(bmd const&) -> bmd&;
+    auto operator+=(basic_bmd const&) -> basic_bmd&;
 
-    auto operator-=(bmd const&) -> bmd&;
+    auto operator-=(basic_bmd const&) -> basic_bmd&;
 
     auto operator~() const;
 
-    auto operator&=(bmd const&) -> bmd&;
+    auto operator&=(basic_bmd const&) -> basic_bmd&;
 
-    auto operator|=(bmd const&) -> bmd&;
+    auto operator|=(basic_bmd const&) -> basic_bmd&;
 
-    auto operator^=(bmd const&) -> bmd&;
+    auto operator^=(basic_bmd const&) -> basic_bmd&;
 
-    friend auto operator*(bmd lhs, bmd const& rhs)
+    friend auto operator*(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs *= rhs;
         return lhs;
     }
 
-    friend auto operator+(bmd lhs, bmd const& rhs)
+    friend auto operator+(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs += rhs;
         return lhs;
     }
 
-    friend auto operator-(bmd lhs, bmd const& rhs)
+    friend auto operator-(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs -= rhs;
         return lhs;
     }
 
-    friend auto operator&(bmd lhs, bmd const& rhs)
+    friend auto operator&(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs &= rhs;
         return lhs;
     }
 
-    friend auto operator|(bmd lhs, bmd const& rhs)
+    friend auto operator|(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs |= rhs;
         return lhs;
     }
 
-    friend auto operator^(bmd lhs, bmd const& rhs)
+    friend auto operator^(basic_bmd lhs, basic_bmd const& rhs)
     {
         lhs ^= rhs;
         return lhs;
     }
 
-    friend auto operator==(bmd const& lhs, bmd const& rhs) noexcept
+    friend auto operator==(basic_bmd const& lhs, basic_bmd const& rhs) noexcept
     {
         assert(lhs.mgr == rhs.mgr);  // check for the same BMD manager
 
         return lhs.f == rhs.f;
     }
 
-    friend auto operator!=(bmd const& lhs, bmd const& rhs) noexcept
+    friend auto operator!=(basic_bmd const& lhs, basic_bmd const& rhs) noexcept
     {
         return !(lhs == rhs);
     }
 
-    friend auto operator<<(std::ostream& os, bmd const& g) -> std::ostream&
+    friend auto operator<<(std::ostream& os, basic_bmd const& g) -> std::ostream&
     {
         os << "BMD handle: " << g.f << '\n';
         os << "BMD manager: " << g.mgr;
         return os;
     }
 
-    [[nodiscard]] auto same_node(bmd const& g) const noexcept
+    [[nodiscard]] auto same_node(basic_bmd const& g) const noexcept
     {
         assert(f);
         assert(mgr == g.mgr);  // BMD g is valid in any case
@@ -191,7 +215,7 @@ class bmd final  // (multiplicative) binary moment diagram
         assert(mgr);
         assert(!is_const());
 
-        return bmd{f->ch()->br().hi, mgr};
+        return basic_bmd{f->ch()->br().hi, mgr};
     }
 
     [[nodiscard]] auto low() const noexcept
@@ -199,7 +223,7 @@ class bmd final  // (multiplicative) binary moment diagram
         assert(mgr);
         assert(!is_const());
 
-        return bmd{f->ch()->br().lo, mgr};
+        return basic_bmd{f->ch()->br().lo, mgr};
     }
 
     [[nodiscard]] auto is_zero() const noexcept;
@@ -213,7 +237,7 @@ class bmd final  // (multiplicative) binary moment diagram
 
     [[nodiscard]] auto eval(std::vector<bool> const&) const;
 
-    [[nodiscard]] auto ite(bmd const&, bmd const&) const;
+    [[nodiscard]] auto ite(basic_bmd const&, basic_bmd const&) const;
 
     [[nodiscard]] auto size() const;
 
@@ -223,7 +247,7 @@ class bmd final  // (multiplicative) binary moment diagram
 
     [[nodiscard]] auto is_essential(var_index) const noexcept;
 
-    [[nodiscard]] auto compose(var_index, bmd const&) const;
+    [[nodiscard]] auto compose(var_index, basic_bmd const&) const;
 
     [[nodiscard]] auto restr(var_index, bool) const;
 
@@ -234,26 +258,20 @@ class bmd final  // (multiplicative) binary moment diagram
     auto dump_dot(std::ostream& = std::cout) const;
 
   private:
-    friend bmd_manager;
+    friend basic_bmd_manager<Int>;
 
-    // wrapper is controlled by its BMD manager
-    bmd(detail::edge_ptr<bmd_int, bmd_int> f, bmd_manager* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    basic_bmd(detail::edge_ptr<Int, Int>, basic_bmd_manager<Int>*);  // wrapper is controlled by its BMD manager
 
-    detail::edge_ptr<bmd_int, bmd_int> f;  // BMD handle
+    detail::edge_ptr<Int, Int> f;  // BMD handle
 
-    bmd_manager* mgr{};  // must be destroyed after this BMD wrapper
+    basic_bmd_manager<Int>* mgr{};  // must be destroyed after this BMD wrapper
 };
 
-class bmd_manager final : public detail::manager<bmd_int, bmd_int>
+template <detail::hashable Int>
+class basic_bmd_manager final : public detail::manager<Int, Int>
 {
   public:
-    explicit bmd_manager(struct config const cfg = {}) :
+    explicit basic_bmd_manager(struct config const cfg = {}) :
             // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks) because BMD terminals are intrusive
             manager{tmls(), cfg}
     {
@@ -264,69 +282,74 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
 
     auto var(std::string_view lbl = {})
     {
-        return bmd{manager::var(expansion::pD, lbl), this};
+        return basic_bmd{manager::var(expansion::pD, lbl), this};
     }
 
     auto var(var_index const x) noexcept
     {
-        return bmd{manager::var(x), this};
+        return basic_bmd{manager::var(x), this};
     }
 
-    auto constant(bmd_int const w, bool const keep_alive = false)
+    auto constant(Int const w, bool const keep_alive = false)
     {
-        return bmd{manager::constant(w, 1, keep_alive), this};
+        return basic_bmd{manager::constant(w, 1, keep_alive), this};
     }
 
     auto zero() noexcept
     {
-        return bmd{manager::constant(0), this};
+        return basic_bmd{manager::constant(0), this};
     }
 
     auto one() noexcept
     {
-        return bmd{manager::constant(1), this};
+        return basic_bmd{manager::constant(1), this};
     }
 
     auto two() noexcept
     {
-        return bmd{manager::constant(2), this};
+        return basic_bmd{manager::constant(2), this};
     }
 
-    [[nodiscard]] auto size(std::vector<bmd> const& fs) const
+    // sum of all BMDs, whereby operands on the same variables are added first (see detail::combine_all)
+    auto sum_all(std::span<basic_bmd<Int> const>) -> basic_bmd<Int>;
+
+    auto product_all(std::span<basic_bmd<Int> const>) -> basic_bmd<Int>;
+
+    [[nodiscard]] auto size(std::vector<basic_bmd<Int>> const& fs) const
     {
         return manager::size(transform(fs));
     }
 
-    [[nodiscard]] auto depth(std::vector<bmd> const& fs) const
+    [[nodiscard]] auto depth(std::vector<basic_bmd<Int>> const& fs) const
     {
         assert(!fs.empty());
 
         return manager::depth(transform(fs));
     }
 
-    auto unsigned_bin(std::vector<bmd> const& fs)  // unsigned binary encoding
+    auto unsigned_bin(std::vector<basic_bmd<Int>> const& fs)  // unsigned binary encoding
     {
-        assert(fs.size() < std::numeric_limits<bmd_int>::digits);  // since weights are represented by bmd_int
+        // since weights are represented by Int
+        assert(!std::numeric_limits<Int>::is_bounded || fs.size() < std::numeric_limits<Int>::digits);
 
         auto sum = manager::constant(0);
         for (auto const i : std::views::iota(0uz, fs.size()))  // LSB...MSB
         {
-            auto const w = static_cast<bmd_int>(1uz << i);  // 2^i
-            sum = plus(sum, mul(fs[i].f, manager::constant(w, 1, false)));
+            sum = plus(sum, mul(fs[i].f, manager::constant(pow2(i), 1, false)));
         }
-        return bmd{sum, this};  // sum of weighted bits
+        return basic_bmd{sum, this};  // sum of weighted bits
     }
 
-    auto twos_complement(std::vector<bmd> const& fs)
+    auto twos_complement(std::vector<basic_bmd<Int>> const& fs)
     {
         assert(!fs.empty());
-        assert(fs.size() <= std::numeric_limits<bmd_int>::digits);
+        assert(!std::numeric_limits<Int>::is_bounded || fs.size() <= std::numeric_limits<Int>::digits);
 
-        auto const w = -static_cast<bmd_int>(1uz << (fs.size() - 1));
-        return bmd{plus(apply(w, fs.back().f), unsigned_bin({fs.begin(), fs.end() - 1}).f), this};
+        auto const w = -pow2(fs.size() - 1);
+        return basic_bmd{plus(apply(w, fs.back().f), unsigned_bin({fs.begin(), fs.end() - 1}).f), this};
     }
 
-    auto dump_dot(std::vector<bmd> const& fs, std::vector<std::string> const& outputs = {},
+    auto dump_dot(std::vector<basic_bmd<Int>> const& fs, std::vector<std::string> const& outputs = {},
                   std::ostream& os = std::cout) const
     {
         assert(outputs.empty() ? true : outputs.size() == fs.size());
@@ -334,10 +357,55 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         manager::dump_dot(transform(fs), outputs, os);
     }
 
+    auto dump_edge_list(std::vector<basic_bmd<Int>> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<basic_bmd<Int>> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
+
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<basic_bmd<Int>> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return basic_bmd{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the BMDs in dst, which can be another BMD manager or a manager of another arithmetic DD type
+    template <typename Manager>
+    auto transfer(std::vector<basic_bmd<Int>> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::template transfer<false>(transform(fs), dst, m);
+    }
+
+    // value of each DD for assignment 64k + j, where bit j of as[x][k] is the value of variable x
+    [[nodiscard]] auto eval_batch(std::vector<basic_bmd<Int>> const& fs,
+                                  std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        return manager::eval_batch(
+            transform(fs), as, [this](auto const& w, auto const& val) { return basic_bmd_manager::agg(w, val); },
+            [this](auto const& val1, auto const& val2) { return basic_bmd_manager::merge(val1, val2); });
+    }
+
   private:
-    using raw_int = boost::safe_numerics::base_type<bmd_int>::type;
+    using manager = detail::manager<Int, Int>;
+
+    using edge = detail::edge<Int, Int>;
+
+    using edge_ptr = detail::edge_ptr<Int, Int>;
+
+    using node = detail::node<Int, Int>;
+
+    using node_ptr = detail::node_ptr<Int, Int>;
 
-    friend bmd;
+    using raw_int = typename boost::safe_numerics::base_type<Int>::type;  // Int itself if it is no safe integer
+
+    friend basic_bmd<Int>;
 
     // NOLINTBEGIN(clang-analyzer-cplusplus.NewDeleteLeaks)
     static auto tmls() -> std::array<edge_ptr, 2>
@@ -347,19 +415,59 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
     }
     // NOLINTEND(clang-analyzer-cplusplus.NewDeleteLeaks)
 
-    static auto transform(std::vector<bmd> const& gs) -> std::vector<edge_ptr>
+    static auto transform(std::vector<basic_bmd<Int>> const& gs) -> std::vector<edge_ptr>
     {
         std::vector<edge_ptr> fs(gs.size());
         std::ranges::transform(gs, fs.begin(), [](auto const& g) { return g.f; });
         return fs;
     }
 
-    static auto normw(edge_ptr const& f, edge_ptr const& g) noexcept -> bmd_int
+    static auto absw(Int const& w) -> Int
+    {
+        if constexpr (std::integral<raw_int>)
+        {
+            return std::abs(static_cast<raw_int>(w));
+        }
+        else
+        {
+            return abs(w);  // found by ADL
+        }
+    }
+
+    static auto pow2(std::size_t const n) -> Int  // 2^n
+    {
+        if constexpr (std::integral<raw_int>)
+        {
+            assert(n < std::numeric_limits<raw_int>::digits);
+
+            return static_cast<raw_int>(raw_int{1} << n);
+        }
+        else
+        {
+            Int w = 1;
+            for (auto i = 0uz; i < n; ++i)
+            {
+                w *= 2;
+            }
+            return w;
+        }
+    }
+
+    static auto normw(edge_ptr const& f, edge_ptr const& g) noexcept(std::integral<raw_int>) -> Int
     {
-        // as there is no risk of overflow in this operation
-        auto const fw = static_cast<raw_int>(f->weight());
-        auto const gw = static_cast<raw_int>(g->weight());
-        return gw < 0 || (fw < 0 && gw == 0) ? -std::gcd(fw, gw) : std::gcd(fw, gw);
+        if constexpr (std::integral<raw_int>)
+        {  // as there is no risk of overflow in this operation
+            auto const fw = static_cast<raw_int>(f->weight());
+            auto const gw = static_cast<raw_int>(g->weight());
+            return gw < 0 || (fw < 0 && gw == 0) ? -std::gcd(fw, gw) : std::gcd(fw, gw);
+        }
+        else
+        {  // e.g., binary GCD of wide_int
+            auto const& fw = f->weight();
+            auto const& gw = g->weight();
+            auto const d = gcd(fw, gw);
+            return gw < 0 || (fw < 0 && gw == 0) ? -d : d;
+        }
     }
 
     auto neg(edge_ptr const& f)
@@ -379,12 +487,12 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         return sub(plus(f, g), mul(manager::constant(2), mul(f, g)));
     }
 
-    [[nodiscard]] auto agg(bmd_int const& w, bmd_int const& val) const -> bmd_int override
+    [[nodiscard]] auto agg(Int const& w, Int const& val) const -> Int override
     {
         return w * val;
     }
 
-    auto apply(bmd_int const& w, edge_ptr const& f) -> edge_ptr override
+    auto apply(Int const& w, edge_ptr const& f) -> edge_ptr override
     {
         assert(f);
 
@@ -396,12 +504,12 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         {
             return manager::constant(0);
         }
-        return uedge(comb(w, f->weight()), f->ch());
+        return this->uedge(comb(w, f->weight()), f->ch());
     }
 
     auto branch(var_index const x, edge_ptr&& hi, edge_ptr&& lo) -> edge_ptr override
     {
-        assert(x < var_count());
+        assert(x < this->var_count());
         assert(hi);
         assert(lo);
 
@@ -415,14 +523,15 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
 
         assert(w != 0);
 
-        return w != 1 ? uedge(w, unode(x, uedge(hi->weight() / w, hi->ch()), uedge(lo->weight() / w, lo->ch())))
-                      : uedge(w, unode(x, std::move(hi), std::move(lo)));
+        return w != 1 ? this->uedge(w, this->unode(x, this->uedge(hi->weight() / w, hi->ch()),
+                                                   this->uedge(lo->weight() / w, lo->ch())))
+                      : this->uedge(w, this->unode(x, std::move(hi), std::move(lo)));
     }
 
     auto cof(edge_ptr const& f, var_index const x, bool const a) -> edge_ptr override
     {
         assert(f);
-        assert(x < var_count());
+        assert(x < this->var_count());
 
         if (f->is_const() || f->ch()->br().x != x)
         {
@@ -431,7 +540,7 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         return a ? apply(f->weight(), f->ch()->br().hi) : apply(f->weight(), f->ch()->br().lo);
     }
 
-    [[nodiscard]] auto comb(bmd_int const& w1, bmd_int const& w2) const -> bmd_int override
+    [[nodiscard]] auto comb(Int const& w1, Int const& w2) const -> Int override
     {
         return w1 * w2;
     }
@@ -462,7 +571,65 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         return sub(plus(f, g), mul(f, g));
     }
 
-    [[nodiscard]] auto merge(bmd_int const& val1, bmd_int const& val2) const -> bmd_int override
+    // NOLINTNEXTLINE(performance-unnecessary-value-param) because simplifications may change pointers
+    auto ite(edge_ptr f, edge_ptr g, edge_ptr h) -> edge_ptr override  // f is expected to be 0/1-valued
+    {
+        assert(f);
+        assert(g);
+        assert(h);
+
+        // terminal cases, which also hold for other values of f due to ite(f, g, h) = h + f(g - h)
+        if (f == manager::constant(0))
+        {
+            return h;
+        }
+        if (f == manager::constant(1) || g == h)
+        {
+            return g;
+        }
+        if (h == manager::constant(0))
+        {
+            return mul(f, g);
+        }
+        if (g == manager::constant(0))
+        {
+            return sub(h, mul(f, h));
+        }
+        if (f->is_const() || (g->is_const() && h->is_const()))
+        {
+            return plus(h, mul(f, sub(g, h)));
+        }
+
+        // factor out the common weight of both branches as ite(f, wg, wh) = w * ite(f, g, h)
+        auto const w = normw(g, h);
+        g = this->uedge(g->weight() / w, g->ch());
+        h = this->uedge(h->weight() / w, h->ch());
+
+        detail::ite op{f, g, h};
+        if (auto const* const entry = this->cached(op))
+        {
+            return apply(w, entry->get_result());
+        }
+
+        // Shannon expansion, whereby the positive cofactor of a moment decomposition is lo + hi
+        auto const x = f->ch()->br().x == this->top_var(f, g) ? this->top_var(f, h) : this->top_var(g, h);
+        auto pos = [x, this](edge_ptr const& e) { return plus(cof(e, x, false), cof(e, x, true)); };
+        auto lo = ite(cof(f, x, false), cof(g, x, false), cof(h, x, false));
+        auto hi = sub(ite(pos(f), pos(g), pos(h)), lo);
+        auto const res = branch(x, std::move(hi), std::move(lo));
+
+        op.set_result(res);
+        this->cache(std::move(op));
+
+        return apply(w, res);
+    }
+
+    [[nodiscard]] auto is_normal(Int const& val) const -> bool override
+    {
+        return val == 1;  // as values are carried by edge weights
+    }
+
+    [[nodiscard]] auto merge(Int const& val1, Int const& val2) const -> Int override
     {
         return val1 + val2;
     }
@@ -492,22 +659,22 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         {
             std::swap(f, g);
         }
-        f = uedge(1, f->ch());
-        g = uedge(1, g->ch());
+        f = this->uedge(1, f->ch());
+        g = this->uedge(1, g->ch());
 
         detail::mul op{f, g};
-        if (auto const* const entry = cached(op))
+        if (auto const* const entry = this->cached(op))
         {
             return apply(w, entry->get_result());
         }
 
-        auto const x = top_var(f, g);
+        auto const x = this->top_var(f, g);
         auto hi = plus(mul(cof(f, x, true), cof(g, x, true)),
                        plus(mul(cof(f, x, true), cof(g, x, false)), mul(cof(f, x, false), cof(g, x, true))));
         auto const res = branch(x, std::move(hi), mul(cof(f, x, false), cof(g, x, false)));
 
         op.set_result(res);
-        cache(std::move(op));
+        this->cache(std::move(op));
 
         return apply(w, res);
     }
@@ -528,12 +695,12 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         if (f->ch() == g->ch())
         {
             auto const sum = f->weight() + g->weight();
-            return sum == 0 ? manager::constant(0) : uedge(sum, f->ch());
+            return sum == 0 ? manager::constant(0) : this->uedge(sum, f->ch());
         }
 
         // rearrange
-        bmd_int w;
-        if (std::abs(static_cast<raw_int>(f->weight())) <= std::abs(static_cast<raw_int>(g->weight())))
+        Int w;
+        if (absw(f->weight()) <= absw(g->weight()))
         {
             std::swap(f, g);
             w = normw(f, g);
@@ -542,211 +709,274 @@ class bmd_manager final : public detail::manager<bmd_int, bmd_int>
         {
             w = normw(g, f);
         }
-        f = uedge(f->weight() / w, f->ch());
-        g = uedge(g->weight() / w, g->ch());
+        f = this->uedge(f->weight() / w, f->ch());
+        g = this->uedge(g->weight() / w, g->ch());
 
         detail::plus op{f, g};
-        if (auto const* const entry = cached(op))
+        if (auto const* const entry = this->cached(op))
         {
             return apply(w, entry->get_result());
         }
 
-        auto const x = top_var(f, g);
+        auto const x = this->top_var(f, g);
         auto const res = branch(x, plus(cof(f, x, true), cof(g, x, true)), plus(cof(f, x, false), cof(g, x, false)));
 
         op.set_result(res);
-        cache(std::move(op));
+        this->cache(std::move(op));
 
         return apply(w, res);
     }
 
-    [[nodiscard]] auto regw() const noexcept -> bmd_int override
+    [[nodiscard]] auto regw() const noexcept -> Int override
     {
         return 1;
     }
+
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<basic_bmd_manager>(this->config());
+    }
 };
 
-inline auto bmd::operator-() const
+template <detail::hashable Int>
+inline basic_bmd<Int>::basic_bmd(detail::edge_ptr<Int, Int> f, basic_bmd_manager<Int>* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator-() const
 {
     assert(mgr);
 
-    return bmd{mgr->neg(f), mgr};
+    return basic_bmd{mgr->neg(f), mgr};
 }
 
-inline auto bmd::operator*=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator*=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->mul(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::operator+=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator+=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->plus(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::operator-=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator-=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->sub(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::operator~() const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator~() const
 {
     assert(mgr);
 
-    return bmd{mgr->complement(f), mgr};
+    return basic_bmd{mgr->complement(f), mgr};
 }
 
-inline auto bmd::operator&=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator&=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::operator|=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator|=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::operator^=(bmd const& rhs) -> bmd&
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::operator^=(basic_bmd const& rhs) -> basic_bmd&
 {
     assert(mgr);
     assert(mgr == rhs.mgr);
 
     f = mgr->antiv(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
 
-inline auto bmd::is_zero() const noexcept
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::is_zero() const noexcept
 {
     assert(mgr);
 
     return *this == mgr->zero();
 }
 
-inline auto bmd::is_one() const noexcept
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::is_one() const noexcept
 {
     assert(mgr);
 
     return *this == mgr->one();
 }
 
-inline auto bmd::is_two() const noexcept
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::is_two() const noexcept
 {
     assert(mgr);
 
     return *this == mgr->two();
 }
 
+template <detail::hashable Int>
 template <typename TruthValue, typename... TruthValues>
-inline auto bmd::fn(TruthValue const a, TruthValues... as) const
+inline auto basic_bmd<Int>::fn(TruthValue const a, TruthValues... as) const
 {
     assert(mgr);
 
-    return bmd{mgr->fn(f, a, std::forward<TruthValues>(as)...), mgr};
+    return basic_bmd{mgr->fn(f, a, std::forward<TruthValues>(as)...), mgr};
 }
 
-inline auto bmd::eval(std::vector<bool> const& as) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::eval(std::vector<bool> const& as) const
 {
     assert(mgr);
 
     return mgr->eval(f, as);
 }
 
-inline auto bmd::ite(bmd const& g, bmd const& h) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::ite(basic_bmd const& g, basic_bmd const& h) const
 {
     assert(mgr);
     assert(mgr == g.mgr);
     assert(g.mgr == h.mgr);
 
-    return bmd{mgr->ite(f, g.f, h.f), mgr};
+    return basic_bmd{mgr->ite(f, g.f, h.f), mgr};
 }
 
-inline auto bmd::size() const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::size() const
 {
     assert(mgr);
 
     return mgr->size({*this});
 }
 
-inline auto bmd::depth() const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::depth() const
 {
     assert(mgr);
 
     return mgr->depth({*this});
 }
 
-inline auto bmd::path_count() const noexcept
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::path_count() const noexcept
 {
     assert(mgr);
 
     return mgr->path_count(f);
 }
 
-inline auto bmd::is_essential(var_index const x) const noexcept
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::is_essential(var_index const x) const noexcept
 {
     assert(mgr);
 
     return mgr->is_essential(f, x);
 }
 
-inline auto bmd::compose(var_index const x, bmd const& g) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::compose(var_index const x, basic_bmd const& g) const
 {
     assert(mgr);
     assert(mgr == g.mgr);
 
-    return bmd{mgr->compose(f, x, g.f), mgr};
+    return basic_bmd{mgr->compose(f, x, g.f), mgr};
 }
 
-inline auto bmd::restr(var_index const x, bool const a) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::restr(var_index const x, bool const a) const
 {
     assert(mgr);
 
-    return bmd{mgr->restr(f, x, a), mgr};
+    return basic_bmd{mgr->restr(f, x, a), mgr};
 }
 
-inline auto bmd::exist(var_index const x) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::exist(var_index const x) const
 {
     assert(mgr);
 
-    return bmd{mgr->exist(f, x), mgr};
+    return basic_bmd{mgr->exist(f, x), mgr};
 }
 
-inline auto bmd::forall(var_index const x) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::forall(var_index const x) const
 {
     assert(mgr);
 
-    return bmd{mgr->forall(f, x), mgr};
+    return basic_bmd{mgr->forall(f, x), mgr};
 }
 
-inline auto bmd::dump_dot(std::ostream& os) const
+template <detail::hashable Int>
+inline auto basic_bmd<Int>::dump_dot(std::ostream& os) const
 {
     assert(mgr);
 
     mgr->dump_dot({*this}, {}, os);
 }
 
+template <detail::hashable Int>
+inline auto basic_bmd_manager<Int>::sum_all(std::span<basic_bmd<Int> const> const fs) -> basic_bmd<Int>
+{
+    return detail::combine_all(
+        fs, zero(), [](basic_bmd<Int> f, basic_bmd<Int> const& g) { return f + g; },
+        [](basic_bmd<Int> const&) { return false; }, [this](basic_bmd<Int> const& h) { return this->support(h.f); });
+}
+
+template <detail::hashable Int>
+inline auto basic_bmd_manager<Int>::product_all(std::span<basic_bmd<Int> const> const fs) -> basic_bmd<Int>
+{
+    auto const z = zero();
+    return detail::combine_all(
+        fs, one(), [](basic_bmd<Int> f, basic_bmd<Int> const& g) { return f * g; },
+        [&z](basic_bmd<Int> const& h) { return h == z; },
+        [this](basic_bmd<Int> const& h) { return this->support(h.f); });
+}
+
 }  // namespace freddy
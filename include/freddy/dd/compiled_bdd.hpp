@@ -0,0 +1,121 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"  // var_index
+
+#include <array>    // std::array
+#include <cassert>  // assert
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t
+#include <span>     // std::span
+#include <utility>  // std::move
+#include <vector>   // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Forwards
+// =====================================================================================================================
+
+class bdd_manager;
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// Branch program of a BDD for repeated point queries, which is independent of its manager once compiled (see
+// bdd_manager::compile). Nodes are stored in reverse DFS postorder, i.e., topologically with each node before its
+// successors, in one array. Edges are encoded as (index << 1) | weight, whereby index 0 is the 0-leaf. An evaluation
+// therefore walks forward through memory and selects each successor by the variable's bit without branching.
+class compiled_bdd final
+{
+  public:
+    compiled_bdd() = default;  // constant 0
+
+    // bit x % 64 of as[x / 64] is the value of variable x
+    [[nodiscard]] auto eval(std::span<std::uint64_t const> const as) const noexcept
+    {
+        assert(as.size() >= words());
+
+        if (vars <= 64)
+        {  // keep the assignment in a register
+            auto const a = as.empty() ? std::uint64_t{} : as[0];
+            return walk([a](std::uint32_t const x) { return (a >> x) & 1u; });
+        }
+        return walk([as](std::uint32_t const x) { return (as[x >> 6u] >> (x & 63u)) & 1u; });
+    }
+
+    [[nodiscard]] auto var_count() const noexcept
+    {
+        return vars;
+    }
+
+    [[nodiscard]] auto words() const noexcept -> std::size_t  // required size of an assignment
+    {
+        return (vars + 63) / 64;
+    }
+
+    [[nodiscard]] auto node_count() const noexcept -> std::size_t  // including the 0-leaf
+    {
+        return nodes.size();
+    }
+
+    // packs an assignment indexed by variable as expected by eval
+    [[nodiscard]] static auto pack(std::vector<bool> const& as)
+    {
+        std::vector<std::uint64_t> ws((as.size() + 63) / 64);
+        for (auto x = 0uz; x < as.size(); ++x)
+        {
+            ws[x / 64] |= static_cast<std::uint64_t>(as[x]) << (x % 64);
+        }
+        return ws;
+    }
+
+  private:
+    friend bdd_manager;
+
+    struct step final
+    {
+        std::uint32_t x;  // variable index
+
+        std::array<std::uint32_t, 2> succ;  // encoded edges to the low and the high successor
+    };
+
+    compiled_bdd(std::vector<step> nodes, std::uint32_t const root, var_index const vars) :
+            nodes{std::move(nodes)},
+            root{root},
+            vars{vars}
+    {}
+
+    template <typename Bit>
+    [[nodiscard]] auto walk(Bit bit) const noexcept -> bool
+    {
+        auto f = root;
+        auto par = f;  // the parity of all complemented edges on the path is the result
+        while (f >> 1u != 0)
+        {  // successors have greater indices, so the walk terminates
+            assert(f >> 1u < nodes.size());
+
+            auto const& v = nodes[f >> 1u];
+            f = v.succ[bit(v.x)];
+            par ^= f;
+        }
+        return (par & 1u) != 0;
+    }
+
+    std::vector<step> nodes{step{}};  // 0-leaf first
+
+    std::uint32_t root{};  // encoded edge
+
+    var_index vars{};
+};
+
+}  // namespace freddy
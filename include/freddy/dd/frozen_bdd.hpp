@@ -0,0 +1,343 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"              // var_index
+#include "freddy/detail/frozen.hpp"       // detail::frozen_header
+#include "freddy/detail/mapped_file.hpp"  // detail::mapped_file
+
+#include <boost/unordered/unordered_flat_map.hpp>  // boost::unordered_flat_map
+
+#include <cassert>     // assert
+#include <cmath>       // std::ldexp
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <cstring>     // std::memcpy
+#include <filesystem>  // std::filesystem::path
+#include <optional>    // std::optional
+#include <span>        // std::span
+#include <stdexcept>   // std::runtime_error
+#include <utility>     // std::as_const
+#include <vector>      // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Forwards
+// =====================================================================================================================
+
+class frozen_bdd_image;
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+class frozen_bdd final  // read-only BDD inside a frozen image
+{
+  public:
+    frozen_bdd() noexcept = default;  // enable default construction for compatibility with standard containers
+
+    friend auto operator==(frozen_bdd const& lhs, frozen_bdd const& rhs) noexcept
+    {
+        assert(lhs.img == rhs.img);  // check for the same image
+
+        return lhs.e == rhs.e;
+    }
+
+    friend auto operator!=(frozen_bdd const& lhs, frozen_bdd const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    [[nodiscard]] auto same_node(frozen_bdd const& g) const noexcept
+    {
+        assert(img == g.img);
+
+        return e >> 1u == g.e >> 1u;
+    }
+
+    [[nodiscard]] auto is_complemented() const noexcept
+    {
+        return (e & 1u) != 0;
+    }
+
+    [[nodiscard]] auto is_const() const noexcept
+    {
+        return e >> 1u == 0;
+    }
+
+    [[nodiscard]] auto is_zero() const noexcept
+    {
+        return e == 0;
+    }
+
+    [[nodiscard]] auto is_one() const noexcept
+    {
+        return e == 1;
+    }
+
+    [[nodiscard]] auto var() const noexcept -> var_index;
+
+    [[nodiscard]] auto high() const noexcept -> frozen_bdd;
+
+    [[nodiscard]] auto low() const noexcept -> frozen_bdd;
+
+    [[nodiscard]] auto eval(std::vector<bool> const&) const noexcept -> bool;
+
+    [[nodiscard]] auto sharpsat() const -> double;
+
+    template <typename Callback>
+    auto for_each_sat(Callback) const;  // paths to 1 as cubes indexed by variable (std::nullopt for don't cares)
+
+  private:
+    friend frozen_bdd_image;
+
+    frozen_bdd(std::uint32_t const e, frozen_bdd_image const* const img) noexcept :
+            e{e},
+            img{img}
+    {}
+
+    std::uint32_t e{};  // encoded edge
+
+    frozen_bdd_image const* img{};  // must be destroyed after this BDD
+};
+
+// Images are written by bdd_manager::freeze and mapped read-only, i.e., there is no deserialization and processes
+// querying the same image share its physical memory. As an image may be corrupt, opening it validates the header, the
+// layout and, in a single pass, every node, so that queries stay within the image and terminate.
+class frozen_bdd_image final
+{
+  public:
+    explicit frozen_bdd_image(std::filesystem::path const& path) :
+            file{path}
+    {
+        auto check = [](bool const cond) {
+            if (!cond)
+            {
+                throw std::runtime_error{"The file is not a valid frozen BDD image of this platform."};
+            }
+        };
+
+        check(file.size() >= sizeof(hdr));
+        std::memcpy(&hdr, file.data(), sizeof(hdr));
+        check(hdr.magic == detail::frozen_magic && hdr.version == detail::frozen_version &&
+              hdr.endianness == detail::frozen_endianness);
+        auto const vars_size = std::size_t{hdr.var_count} * sizeof(var_index);
+        auto const roots_size = std::size_t{hdr.root_count} * sizeof(std::uint32_t);
+        check(hdr.node_count > 0 &&
+              file.size() == sizeof(hdr) + vars_size + roots_size + hdr.node_count * sizeof(detail::frozen_node));
+
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast) as the image is used in place
+        lvl2var = reinterpret_cast<var_index const*>(file.data() + sizeof(hdr));
+        rts = reinterpret_cast<std::uint32_t const*>(file.data() + sizeof(hdr) + vars_size);
+        nodes = reinterpret_cast<detail::frozen_node const*>(file.data() + sizeof(hdr) + vars_size + roots_size);
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        for (auto const f : roots_span())
+        {
+            check(f >> 1u < hdr.node_count);
+        }
+        std::vector<bool> seen(hdr.var_count);
+        for (auto const x : std::span{lvl2var, hdr.var_count})
+        {
+            check(x < hdr.var_count && !seen[x]);
+            seen[x] = true;
+        }
+        for (auto i = 1u; i < hdr.node_count; ++i)
+        {  // successors must have smaller indices
+            auto const& v = nodes[i];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            check(v.x < hdr.var_count && v.hi >> 1u < i && v.lo >> 1u < i);
+        }
+    }
+
+    frozen_bdd_image(frozen_bdd_image const&) = delete;
+
+    frozen_bdd_image(frozen_bdd_image&&) = delete;
+
+    auto operator=(frozen_bdd_image const&) = delete;
+
+    auto operator=(frozen_bdd_image&&) = delete;
+
+    ~frozen_bdd_image() = default;
+
+    [[nodiscard]] auto var_count() const noexcept -> var_index
+    {
+        return hdr.var_count;
+    }
+
+    [[nodiscard]] auto order() const noexcept
+    {
+        return std::span<var_index const>{lvl2var, hdr.var_count};
+    }
+
+    [[nodiscard]] auto node_count() const noexcept -> std::size_t
+    {
+        return hdr.node_count;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t  // number of BDDs
+    {
+        return hdr.root_count;
+    }
+
+    [[nodiscard]] auto operator[](std::size_t const i) const noexcept
+    {
+        assert(i < size());
+
+        return frozen_bdd{roots_span()[i], this};
+    }
+
+    [[nodiscard]] auto roots() const
+    {
+        std::vector<frozen_bdd> fs;
+        fs.reserve(size());
+        for (auto const f : roots_span())
+        {
+            fs.push_back(frozen_bdd{f, this});
+        }
+        return fs;
+    }
+
+  private:
+    friend frozen_bdd;
+
+    [[nodiscard]] auto roots_span() const noexcept -> std::span<std::uint32_t const>
+    {
+        return std::span<std::uint32_t const>{rts, hdr.root_count};
+    }
+
+    [[nodiscard]] auto node(std::uint32_t const f) const noexcept -> detail::frozen_node const&
+    {
+        assert(f >> 1u != 0);  // not the 0-leaf
+        assert(f >> 1u < hdr.node_count);
+
+        return nodes[f >> 1u];  // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    [[nodiscard]] auto eval(std::uint32_t f, std::vector<bool> const& as) const noexcept
+    {
+        assert(as.size() == var_count());
+
+        auto val = (f & 1u) != 0;
+        while (f >> 1u != 0)
+        {  // successors have smaller indices, so the walk terminates
+            auto const& v = node(f);
+            auto const g = as[v.x] ? v.hi : v.lo;
+
+            assert(g >> 1u < f >> 1u);
+
+            val ^= (g & 1u) != 0;
+            f = g;
+        }
+        return val;
+    }
+
+    [[nodiscard]] auto density(std::uint32_t const f, boost::unordered_flat_map<std::uint32_t, double>& memo) const
+        -> double
+    {  // fraction of satisfying assignments
+        auto const i = f >> 1u;
+        auto res = 0.0;
+        if (i != 0)
+        {
+            if (auto const it = memo.find(i); it != memo.end())
+            {
+                res = it->second;
+            }
+            else
+            {
+                auto const& v = node(f);
+                res = (density(v.hi, memo) + density(v.lo, memo)) / 2;
+                memo.emplace(i, res);
+            }
+        }
+        return (f & 1u) != 0 ? 1 - res : res;
+    }
+
+    template <typename Callback>
+    auto for_each_sat(std::uint32_t const f, bool val, std::vector<std::optional<bool>>& cube, Callback& cb) const
+        -> void
+    {
+        val ^= (f & 1u) != 0;
+        if (f >> 1u == 0)
+        {
+            if (val)
+            {
+                cb(std::as_const(cube));
+            }
+            return;
+        }
+
+        auto const& v = node(f);
+        cube[v.x] = false;
+        for_each_sat(v.lo, val, cube, cb);
+        cube[v.x] = true;
+        for_each_sat(v.hi, val, cube, cb);
+        cube[v.x].reset();
+    }
+
+    detail::mapped_file file;  // must be initialized first
+
+    detail::frozen_header hdr{};
+
+    var_index const* lvl2var{};
+
+    std::uint32_t const* rts{};  // encoded root edges
+
+    detail::frozen_node const* nodes{};  // bottom-up by level, 0-leaf first
+};
+
+inline auto frozen_bdd::var() const noexcept -> var_index
+{
+    assert(img);
+    assert(!is_const());
+
+    return img->node(e).x;
+}
+
+inline auto frozen_bdd::high() const noexcept -> frozen_bdd
+{
+    assert(img);
+    assert(!is_const());
+
+    return frozen_bdd{img->node(e).hi, img};
+}
+
+inline auto frozen_bdd::low() const noexcept -> frozen_bdd
+{
+    assert(img);
+    assert(!is_const());
+
+    return frozen_bdd{img->node(e).lo, img};
+}
+
+inline auto frozen_bdd::eval(std::vector<bool> const& as) const noexcept -> bool
+{
+    assert(img);
+
+    return img->eval(e, as);
+}
+
+inline auto frozen_bdd::sharpsat() const -> double
+{
+    assert(img);
+
+    boost::unordered_flat_map<std::uint32_t, double> memo;
+    return std::ldexp(img->density(e, memo), static_cast<int>(img->var_count()));
+}
+
+template <typename Callback>
+auto frozen_bdd::for_each_sat(Callback cb) const
+{
+    assert(img);
+
+    std::vector<std::optional<bool>> cube(img->var_count());
+    img->for_each_sat(e, false, cube, cb);
+}
+
+}  // namespace freddy
@@ -0,0 +1,145 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"                 // var_index
+#include "freddy/detail/operation/isop.hpp"  // detail::cover_ptr
+
+#include <boost/unordered/unordered_flat_map.hpp>  // boost::unordered_flat_map
+#include <boost/unordered/unordered_flat_set.hpp>  // boost::unordered_flat_set
+
+#include <cstddef>   // std::size_t
+#include <optional>  // std::optional
+#include <utility>   // std::as_const
+#include <vector>    // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Forwards
+// =====================================================================================================================
+
+class bdd_manager;
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// Irredundant sum-of-products cover computed by bdd_manager::isop. Subcovers are shared, i.e., the cover is a graph
+// whose size is linear in the number of ISOP subproblems. Cubes are therefore counted on this graph and streamed
+// instead of materializing them.
+class isop_cover final
+{
+  public:
+    using cube = std::vector<std::optional<bool>>;  // indexed by variable (std::nullopt for absent variables)
+
+    isop_cover() = default;  // empty cover
+
+    [[nodiscard]] auto var_count() const noexcept
+    {
+        return vars;
+    }
+
+    [[nodiscard]] auto node_count() const
+    {
+        boost::unordered_flat_set<detail::cover_node const*> marks;
+        node_count(root.get(), marks);
+        return marks.size();
+    }
+
+    [[nodiscard]] auto cube_count() const
+    {
+        boost::unordered_flat_map<detail::cover_node const*, double> memo;
+        return cube_count(root.get(), memo);
+    }
+
+    template <typename Callback>
+    auto for_each_cube(Callback cb) const  // the cube is updated in place
+    {
+        cube cur(vars);
+        for_each_cube(root.get(), cur, cb);
+    }
+
+    [[nodiscard]] auto cubes() const
+    {
+        std::vector<cube> cs;
+        for_each_cube([&cs](cube const& c) { cs.push_back(c); });
+        return cs;
+    }
+
+  private:
+    friend bdd_manager;
+
+    isop_cover(detail::cover_ptr root, var_index const vars) :
+            root{std::move(root)},
+            vars{vars}
+    {}
+
+    static auto node_count(detail::cover_node const* const c,
+                           boost::unordered_flat_set<detail::cover_node const*>& marks) -> void
+    {
+        if (c == nullptr || !marks.insert(c).second || c->x == detail::cover_node::taut_var)
+        {
+            return;
+        }
+
+        node_count(c->neg.get(), marks);
+        node_count(c->pos.get(), marks);
+        node_count(c->dc.get(), marks);
+    }
+
+    static auto cube_count(detail::cover_node const* const c,
+                           boost::unordered_flat_map<detail::cover_node const*, double>& memo) -> double
+    {
+        if (c == nullptr)
+        {
+            return 0;
+        }
+        if (c->x == detail::cover_node::taut_var)
+        {
+            return 1;
+        }
+        if (auto const it = memo.find(c); it != memo.end())
+        {
+            return it->second;
+        }
+
+        auto const n = cube_count(c->neg.get(), memo) + cube_count(c->pos.get(), memo) + cube_count(c->dc.get(), memo);
+        memo.emplace(c, n);
+        return n;
+    }
+
+    template <typename Callback>
+    static auto for_each_cube(detail::cover_node const* const c, cube& cur, Callback& cb) -> void
+    {
+        if (c == nullptr)
+        {
+            return;
+        }
+        if (c->x == detail::cover_node::taut_var)
+        {
+            cb(std::as_const(cur));
+            return;
+        }
+
+        cur[c->x] = false;
+        for_each_cube(c->neg.get(), cur, cb);
+        cur[c->x] = true;
+        for_each_cube(c->pos.get(), cur, cb);
+        cur[c->x].reset();
+        for_each_cube(c->dc.get(), cur, cb);
+    }
+
+    detail::cover_ptr root;
+
+    var_index vars{};
+};
+
+}  // namespace freddy
@@ -5,6 +5,7 @@
 // *********************************************************************************************************************
 
 #include "freddy/config.hpp"                     // config
+#include "freddy/detail/cube.hpp"                // detail::cube_range
 #include "freddy/detail/manager.hpp"             // detail::manager
 #include "freddy/detail/node.hpp"                // detail::edge_ptr
 #include "freddy/detail/operation/antiv.hpp"     // detail::antiv
@@ -18,6 +19,9 @@
 #include <cassert>      // assert
 #include <cstdint>      // std::int32_t
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
+#include <memory>       // std::make_unique
 #include <ostream>      // std::ostream
 #include <string>       // std::string
 #include <string_view>  // std::string_view
@@ -165,6 +169,8 @@ class kfdd final  // Kronecker functional decision diagram
 
     [[nodiscard]] auto sharpsat() const;
 
+    [[nodiscard]] auto cubes() const;  // lazy enumeration of the disjoint cubes covering the satisfying assignments
+
     [[nodiscard]] auto manager() const noexcept -> kfdd_manager const&
     {
         return *mgr;
@@ -175,14 +181,7 @@ class kfdd final  // Kronecker functional decision diagram
   private:
     friend kfdd_manager;
 
-    // wrapper is controlled by its KFDD manager
-    kfdd(detail::edge_ptr<bool, bool> f, kfdd_manager* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    kfdd(detail::edge_ptr<bool, bool>, kfdd_manager*);  // wrapper is controlled by its KFDD manager
 
     detail::edge_ptr<bool, bool> f;  // KFDD handle
 
@@ -237,6 +236,39 @@ class kfdd_manager final : public detail::manager<bool, bool>
         manager::dump_dot(transform(fs), outputs, os);
     }
 
+    auto dump_edge_list(std::vector<kfdd> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<kfdd> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
+
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<kfdd> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return kfdd{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the KFDDs in dst, which can be another KFDD manager (e.g., with other decomposition types) or a manager
+    // of any other DD type
+    template <typename Manager>
+    auto transfer(std::vector<kfdd> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::transfer<true>(transform(fs), dst, m);
+    }
+
+    // bit j of as[x][k] is the value of variable x in assignment 64k + j, and so is bit j of word k of each result
+    [[nodiscard]] auto eval_batch(std::vector<kfdd> const& fs, std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        return manager::eval_batch(transform(fs), as, [](bool const c) { return c; });
+    }
+
     // DTL sifting wrapper for KFDD-typed vectors
     void dtl_sift()
     {
@@ -314,6 +346,23 @@ class kfdd_manager final : public detail::manager<bool, bool>
         return cache(std::move(op))->get_result();
     }
 
+    [[nodiscard]] auto cubes(edge_ptr const& f)
+    {  // Davio nodes do not represent cofactors, so the cofactor that is not a successor is computed on the way
+        assert(f);
+
+        auto cof = [this](edge_ptr const& g) {
+            auto const& br = g->ch()->br();
+            switch (decomposition(br.x))
+            {
+                case expansion::S: return std::pair{br.lo, br.hi};
+                case expansion::pD: return std::pair{br.lo, antiv(br.hi, br.lo)};
+                case expansion::nD: return std::pair{antiv(br.hi, br.lo), br.lo};
+                default: assert(false); std::unreachable();
+            }
+        };
+        return detail::cube_range{f, var_count(), std::move(cof), [](edge_ptr const&, bool const m) { return m; }};
+    }
+
     auto sharpsat(edge_ptr const& f)
     {
         assert(f);
@@ -569,12 +618,22 @@ class kfdd_manager final : public detail::manager<bool, bool>
         }
 
         auto const x = f->ch()->br().x == top_var(f, g) ? top_var(f, h) : top_var(g, h);
+        if (decomposition(x) != expansion::S)
+        {  // ite does not distribute over Boolean differences (the high successors of Davio nodes)
+            op.set_result(disj(conj(f, g), conj(complement(f), h)));
+            return cache(std::move(op))->get_result();
+        }
 
         op.set_result(branch(x, ite(cof(f, x, true), cof(g, x, true), cof(h, x, true)),
                              ite(cof(f, x, false), cof(g, x, false), cof(h, x, false))));
         return cache(std::move(op))->get_result();
     }
 
+    [[nodiscard]] auto is_normal(bool const& val) const noexcept -> bool override
+    {
+        return !val;  // as 1 is the complemented 0-leaf
+    }
+
     [[nodiscard]] auto merge(bool const& val1, bool const& val2) const noexcept -> bool override
     {
         return val1 != val2;
@@ -594,8 +653,28 @@ class kfdd_manager final : public detail::manager<bool, bool>
     {
         return false;  // means a regular (non-complemented) edge
     }
+
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<kfdd_manager>(config());
+    }
+
+    [[nodiscard]] auto supports_dtl() const noexcept -> bool override
+    {
+        return true;
+    }
 };
 
+inline kfdd::kfdd(detail::edge_ptr<bool, bool> f, kfdd_manager* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
 inline auto kfdd::operator~() const
 {
     assert(mgr);
@@ -609,6 +688,7 @@ inline auto kfdd::operator&=(kfdd const& rhs) -> kfdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -619,6 +699,7 @@ inline auto kfdd::operator|=(kfdd const& rhs) -> kfdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -629,6 +710,7 @@ inline auto kfdd::operator^=(kfdd const& rhs) -> kfdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->antiv(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -735,6 +817,13 @@ inline auto kfdd::sharpsat() const
     return mgr->sharpsat(f);
 }
 
+inline auto kfdd::cubes() const
+{
+    assert(mgr);
+
+    return mgr->cubes(f);
+}
+
 inline auto kfdd::dump_dot(std::ostream& os) const
 {
     assert(mgr);
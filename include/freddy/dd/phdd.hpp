@@ -7,6 +7,7 @@
 #include "freddy/config.hpp"                 // config
 #include "freddy/detail/manager.hpp"         // detail::manager
 #include "freddy/detail/node.hpp"            // detail::edge_ptr
+#include "freddy/detail/operation/ite.hpp"   // detail::ite
 #include "freddy/detail/operation/mul.hpp"   // detail::mul
 #include "freddy/detail/operation/plus.hpp"  // detail::plus
 #include "freddy/expansion.hpp"              // expansion::pD
@@ -18,7 +19,10 @@
 #include <cmath>        // std::signbit
 #include <cstdint>      // std::int32_t
 #include <iostream>     // std::cout
+#include <istream>      // std::istream
+#include <iterator>     // std::back_inserter
 #include <limits>       // std::numeric_limits
+#include <memory>       // std::make_unique
 #include <ostream>      // std::ostream
 #include <string>       // std::string
 #include <string_view>  // hash
@@ -238,14 +242,7 @@ class phdd  // (multiplicative) power hybrid decision diagram
   private:
     friend phdd_manager;
 
-    // wrapper is controlled by its PHDD manager
-    phdd(detail::edge_ptr<phdd_weight, double> f, phdd_manager* const mgr) :
-            f{std::move(f)},
-            mgr{mgr}
-    {
-        assert(this->f);
-        assert(this->mgr);
-    }
+    phdd(detail::edge_ptr<phdd_weight, double>, phdd_manager*);  // wrapper is controlled by its PHDD manager
 
     detail::edge_ptr<phdd_weight, double> f;  // PHDD handle
 
@@ -335,6 +332,40 @@ class phdd_manager final : public detail::manager<phdd_weight, double>
         manager::dump_dot(transform(fs), outputs, os);
     }
 
+    auto dump_edge_list(std::vector<phdd> const& fs, std::ostream& os = std::cout) const
+    {
+        manager::dump_edge_list(transform(fs), os);
+    }
+
+    auto save(std::vector<phdd> const& fs, std::ostream& os) const
+    {
+        manager::save(transform(fs), os);
+    }
+
+    auto load(std::istream& is)
+    {
+        auto const gs = manager::load(is);
+        std::vector<phdd> fs;
+        fs.reserve(gs.size());
+        std::ranges::transform(gs, std::back_inserter(fs), [this](auto const& g) { return phdd{g, this}; });
+        return fs;
+    }
+
+    // rebuilds the PHDDs in dst, which can be another PHDD manager or a manager of another arithmetic DD type
+    template <typename Manager>
+    auto transfer(std::vector<phdd> const& fs, Manager& dst, var_mapping const m = var_mapping::INDEX) const
+    {
+        return manager::transfer<false>(transform(fs), dst, m);
+    }
+
+    // value of each DD for assignment 64k + j, where bit j of as[x][k] is the value of variable x
+    [[nodiscard]] auto eval_batch(std::vector<phdd> const& fs, std::vector<std::vector<std::uint64_t>> const& as) const
+    {
+        return manager::eval_batch(
+            transform(fs), as, [this](auto const& w, auto const& val) { return phdd_manager::agg(w, val); },
+            [this](auto const& val1, auto const& val2) { return phdd_manager::merge(val1, val2); });
+    }
+
   private:
     friend phdd;
 
@@ -504,6 +535,67 @@ class phdd_manager final : public detail::manager<phdd_weight, double>
         return sub(plus(f, g), mul(f, g));
     }
 
+    // NOLINTNEXTLINE(performance-unnecessary-value-param) because simplifications may change pointers
+    auto ite(edge_ptr f, edge_ptr g, edge_ptr h) -> edge_ptr override  // f is expected to be 0/1-valued
+    {
+        assert(f);
+        assert(g);
+        assert(h);
+
+        // terminal cases, which also hold for other values of f due to ite(f, g, h) = h + f(g - h)
+        if (f == manager::constant(0))
+        {
+            return h;
+        }
+        if (f == manager::constant(1) || g == h)
+        {
+            return g;
+        }
+        if (h == manager::constant(0))
+        {
+            return mul(f, g);
+        }
+        if (g == manager::constant(0))
+        {
+            return sub(h, mul(f, h));
+        }
+        if (f->is_const() || (g->is_const() && h->is_const()))
+        {
+            return plus(h, mul(f, sub(g, h)));
+        }
+
+        // factor out the common weight of both branches as ite(f, wg, wh) = w * ite(f, g, h)
+        auto const w = normw(g, h);
+        g = uedge({g->weight().first ^ w.first, g->weight().second - w.second}, g->ch());
+        h = uedge({h->weight().first ^ w.first, h->weight().second - w.second}, h->ch());
+
+        detail::ite op{f, g, h};
+        if (auto const* const entry = cached(op))
+        {
+            return apply(w, entry->get_result());
+        }
+
+        // Shannon expansion, whereby the positive cofactor of a positive Davio decomposition is lo + hi
+        auto const x = f->ch()->br().x == top_var(f, g) ? top_var(f, h) : top_var(g, h);
+        auto const s = decomposition(x) == expansion::S;
+        auto pos = [x, s, this](edge_ptr const& e) {
+            return s ? cof(e, x, true) : plus(cof(e, x, false), cof(e, x, true));
+        };
+        auto lo = ite(cof(f, x, false), cof(g, x, false), cof(h, x, false));
+        auto hi = ite(pos(f), pos(g), pos(h));
+        auto const res = s ? branch(x, std::move(hi), std::move(lo)) : branch(x, sub(hi, lo), std::move(lo));
+
+        op.set_result(res);
+        cache(std::move(op));
+
+        return apply(w, res);
+    }
+
+    [[nodiscard]] auto is_normal(double const& val) const noexcept -> bool override
+    {  // odd significands, as powers of two are carried by edge weights
+        return val == 0 || (val >= 1 && val < 0x1p53 && std::fmod(val, 2) == 1);
+    }
+
     [[nodiscard]] auto merge(double const& val1, double const& val2) const -> double override
     {
         return val1 + val2;
@@ -656,8 +748,23 @@ class phdd_manager final : public detail::manager<phdd_weight, double>
     {
         return {false, 0};
     }
+
+    [[nodiscard]] auto spawn() const -> std::unique_ptr<manager> override
+    {
+        return std::make_unique<phdd_manager>(config());
+    }
 };
 
+inline phdd::phdd(detail::edge_ptr<phdd_weight, double> f, phdd_manager* const mgr) :
+        f{std::move(f)},
+        mgr{mgr}
+{
+    assert(this->f);
+    assert(this->mgr);
+
+    this->mgr->safe_point();  // as an operation is completed when its result is wrapped
+}
+
 inline auto phdd::operator-() const
 {
     assert(mgr);
@@ -671,6 +778,7 @@ inline auto phdd::operator*=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->mul(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -681,6 +789,7 @@ inline auto phdd::operator+=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->plus(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -691,6 +800,7 @@ inline auto phdd::operator-=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->sub(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -708,6 +818,7 @@ inline auto phdd::operator&=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->conj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -718,6 +829,7 @@ inline auto phdd::operator|=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->disj(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
@@ -728,6 +840,7 @@ inline auto phdd::operator^=(phdd const& rhs) -> phdd&
     assert(mgr == rhs.mgr);
 
     f = mgr->antiv(f, rhs.f);
+    mgr->safe_point();
 
     return *this;
 }
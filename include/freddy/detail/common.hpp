@@ -15,10 +15,19 @@
 #endif
 
 #include <algorithm>    // std::max
+#include <array>        // std::array
+#include <bit>          // std::popcount
 #include <cassert>      // assert
+#include <charconv>     // std::to_chars
 #include <concepts>     // std::convertible_to
 #include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint64_t
+#include <istream>      // std::istream
 #include <memory>       // std::pointer_traits
+#include <ostream>      // std::ostream
+#include <span>         // std::span
+#include <sstream>      // std::ostringstream
+#include <string_view>  // std::string_view
 #include <thread>       // std::thread
 #include <type_traits>  // std::true_type
 #include <utility>      // std::declval
@@ -101,6 +110,104 @@ struct equal final
     }
 };
 
+class out_buffer final  // formats output in large chunks instead of token by token as for stream insertions
+{
+  public:
+    explicit out_buffer(std::ostream& os) :
+            os{os}
+    {}
+
+    out_buffer(out_buffer const&) = delete;
+
+    out_buffer(out_buffer&&) = delete;
+
+    auto operator=(out_buffer const&) = delete;
+
+    auto operator=(out_buffer&&) = delete;
+
+    ~out_buffer()
+    {
+        flush();
+    }
+
+    auto operator<<(std::string_view const s) -> out_buffer&
+    {
+        if (s.size() > buf.size() - len)
+        {
+            flush();
+            if (s.size() > buf.size())
+            {
+                os.write(s.data(), static_cast<std::streamsize>(s.size()));
+                return *this;
+            }
+        }
+        std::ranges::copy(s, buf.begin() + static_cast<std::ptrdiff_t>(len));
+        len += s.size();
+        return *this;
+    }
+
+    auto operator<<(char const* const s) -> out_buffer&
+    {
+        return *this << std::string_view{s};
+    }
+
+    auto operator<<(char const c) -> out_buffer&
+    {
+        return *this << std::string_view{&c, 1};
+    }
+
+    auto operator<<(bool const b) -> out_buffer&
+    {
+        return *this << (b ? '1' : '0');
+    }
+
+    auto operator<<(std::integral auto const n) -> out_buffer&
+    {
+        std::array<char, 24> tmp{};  // enough for 64-bit integers including the sign
+        auto const* const end = std::to_chars(tmp.data(), tmp.data() + tmp.size(), n).ptr;
+        return *this << std::string_view{tmp.data(), end};
+    }
+
+    auto operator<<(void const* const p) -> out_buffer&
+    {
+        std::array<char, 2 + 2 * sizeof(std::uintptr_t)> tmp{'0', 'x'};
+        auto const* const end =
+            std::to_chars(tmp.data() + 2, tmp.data() + tmp.size(), reinterpret_cast<std::uintptr_t>(p), 16).ptr;
+        return *this << std::string_view{tmp.data(), end};
+    }
+
+    template <typename T>
+    auto put(T const& val) -> out_buffer&  // for weights/values, which can also be safe integers intercepting <<
+    {
+        if constexpr (std::integral<T>)
+        {
+            *this << val;
+        }
+        else
+        {  // values such as floating-point numbers are formatted as usual
+            fmt.str({});
+            fmt << val;
+            *this << fmt.view();
+        }
+        return *this;
+    }
+
+    auto flush() -> void
+    {
+        os.write(buf.data(), static_cast<std::streamsize>(len));
+        len = 0;
+    }
+
+  private:
+    std::ostream& os;
+
+    std::array<char, 1uz << 16uz> buf{};  // 64 KiB
+
+    std::size_t len{};
+
+    std::ostringstream fmt;
+};
+
 // =====================================================================================================================
 // Functions
 // =====================================================================================================================
@@ -155,4 +262,170 @@ inline auto parallel_for(std::integral auto const a, std::integral auto const b,
     }
 }
 
+template <typename T>
+auto read_bin(std::istream& is) -> T  // counterpart of write_bin
+{
+    if constexpr (requires(T const& val) {
+                      val.first;
+                      val.second;
+                  })
+    {
+        auto first = read_bin<decltype(T::first)>(is);
+        auto second = read_bin<decltype(T::second)>(is);
+        return T{std::move(first), std::move(second)};
+    }
+    else if constexpr (std::same_as<T, bool>)
+    {  // bit patterns other than 0 and 1 are no valid bools
+        auto const byte = is.get();
+        if (byte != 0 && byte != 1)
+        {
+            is.setstate(std::ios::failbit);
+        }
+        return byte == 1;
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T requires a native binary representation");
+
+        std::array<char, sizeof(T)> buf{};
+        is.read(buf.data(), buf.size());
+        return std::bit_cast<T>(buf);
+    }
+}
+
+inline auto read_varint(std::istream& is) -> std::uint64_t  // counterpart of write_varint
+{
+    std::uint64_t n{};
+    for (auto shift = 0u; shift < 64; shift += 7)
+    {
+        auto const byte = is.get();
+        if (!is)
+        {
+            break;
+        }
+        n |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return n;
+        }
+    }
+    is.setstate(std::ios::failbit);  // truncated or too long
+    return n;
+}
+
+// Combines all operands by a commutative and associative operation (e.g., conjunction). The smallest (intermediate)
+// result is always combined with the operand whose support overlaps most with its own, i.e., operands on the same
+// variables are clustered before unrelated ones are merged. This keeps intermediate DDs small regardless of the operand
+// order. Consumed results are released right away so that GC can reclaim them, and the reduction stops as soon as a
+// result is absorbing (e.g., 0 for a conjunction). Support maps an operand to its essential variables.
+template <typename DD, typename Op, typename Absorbing, typename Support>
+auto combine_all(std::span<DD const> const fs, DD unit, Op op, Absorbing absorbs, Support support)
+{
+    struct entry final
+    {
+        DD f;
+
+        std::vector<std::uint64_t> vars;  // support as bit set
+
+        std::size_t size;
+    };
+
+    auto const overlap = [](entry const& a, entry const& b) {  // Jaccard index of the supports
+        auto common = 0, all = 0;
+        for (auto i = 0uz; i < a.vars.size(); ++i)
+        {
+            common += std::popcount(a.vars[i] & b.vars[i]);
+            all += std::popcount(a.vars[i] | b.vars[i]);
+        }
+        return all == 0 ? 1.0 : static_cast<double>(common) / all;
+    };
+
+    std::vector<entry> es;
+    es.reserve(fs.size());
+    for (auto const& f : fs)
+    {
+        if (absorbs(f))
+        {
+            return f;
+        }
+
+        auto const xs = support(f);
+        std::vector<std::uint64_t> vars((xs.size() + 63) / 64);
+        for (auto x = 0uz; x < xs.size(); ++x)
+        {
+            vars[x / 64] |= static_cast<std::uint64_t>(xs[x]) << (x % 64);
+        }
+        es.push_back({.f = f, .vars = std::move(vars), .size = f.size()});
+    }
+
+    while (es.size() > 1)
+    {
+        auto const a = static_cast<std::size_t>(std::ranges::min_element(es, {}, &entry::size) - es.begin());
+        auto b = a == 0 ? 1uz : 0uz;
+        auto best = -1.0;
+        for (auto i = 0uz; i < es.size(); ++i)
+        {
+            if (i == a)
+            {
+                continue;
+            }
+            auto const o = overlap(es[a], es[i]);
+            if (o > best || (o == best && es[i].size < es[b].size))
+            {
+                best = o;
+                b = i;
+            }
+        }
+
+        auto h = op(es[a].f, es[b].f);
+        if (absorbs(h))
+        {
+            return h;
+        }
+
+        auto vars = std::move(es[a].vars);
+        for (auto i = 0uz; i < vars.size(); ++i)
+        {
+            vars[i] |= es[b].vars[i];
+        }
+
+        // release the operands and queue the result behind the operands of the same size
+        es.erase(es.begin() + static_cast<std::ptrdiff_t>(std::max(a, b)));
+        es.erase(es.begin() + static_cast<std::ptrdiff_t>(std::min(a, b)));
+        auto const size = h.size();
+        es.push_back({.f = std::move(h), .vars = std::move(vars), .size = size});
+    }
+    return es.empty() ? unit : es.front().f;
+}
+
+template <typename T>
+auto write_bin(std::ostream& os, T const& val)  // in the native byte order of the platform
+{
+    if constexpr (requires {
+                      val.first;
+                      val.second;
+                  })
+    {  // e.g., PHDD edge weights
+        write_bin(os, val.first);
+        write_bin(os, val.second);
+    }
+    else
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "T requires a native binary representation");
+
+        auto const buf = std::bit_cast<std::array<char, sizeof(T)>>(val);
+        os.write(buf.data(), buf.size());
+    }
+}
+
+inline auto write_varint(std::ostream& os, std::uint64_t n)  // LEB128, i.e., 7 bits per byte
+{
+    while (n >= 0x80)
+    {
+        os.put(static_cast<char>((n & 0x7F) | 0x80));
+        n >>= 7;
+    }
+    os.put(static_cast<char>(n));
+}
+
 }  // namespace freddy::detail
@@ -0,0 +1,173 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"  // var_index
+
+#include <cassert>   // assert
+#include <cstddef>   // std::ptrdiff_t
+#include <cstdint>   // std::uint8_t
+#include <iterator>  // std::default_sentinel_t
+#include <optional>  // std::optional
+#include <utility>   // std::move
+#include <vector>    // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy::detail
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// Lazy enumeration of the disjoint cubes of a Boolean DD with complemented edges. It is a depth-first traversal that
+// is suspended whenever a solution is reached, so its state is one frame per variable on the current path and the
+// cube is updated in place. Cofactor maps an edge to a non-constant node to its negative and positive cofactor, and
+// Leaf decides whether a constant reached with the given parity is a solution. The DD must not be modified (e.g.,
+// reordered) while enumerating.
+template <typename Edge, typename Cofactor, typename Leaf>
+class cube_range final
+{
+  public:
+    using cube = std::vector<std::optional<bool>>;  // indexed by variable (std::nullopt for don't cares)
+
+    class iterator final
+    {
+      public:
+        using difference_type = std::ptrdiff_t;
+
+        using value_type = cube;
+
+        iterator() noexcept = default;
+
+        explicit iterator(cube_range* const rng) noexcept :
+                rng{rng}
+        {}
+
+        auto operator*() const noexcept -> cube const&
+        {
+            assert(rng);
+
+            return rng->cur;
+        }
+
+        auto operator++() -> iterator&
+        {
+            assert(rng);
+
+            rng->advance();
+            return *this;
+        }
+
+        auto operator++(int)
+        {
+            ++*this;
+        }
+
+        auto operator==(std::default_sentinel_t) const noexcept
+        {
+            assert(rng);
+
+            return rng->done;
+        }
+
+      private:
+        cube_range* rng{};
+    };
+
+    cube_range(Edge f, std::size_t const var_count, Cofactor cof, Leaf leaf) :
+            f{std::move(f)},
+            cur(var_count),
+            cof{std::move(cof)},
+            leaf{std::move(leaf)}
+    {}
+
+    // single pass, i.e., the enumeration starts with the first call
+    [[nodiscard]] auto begin()
+    {
+        if (!started)
+        {
+            started = true;
+            if (!visit(f, false))
+            {
+                advance();
+            }
+        }
+        return iterator{this};
+    }
+
+    [[nodiscard]] auto end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+  private:
+    struct frame final
+    {
+        Edge lo, hi;  // cofactors
+
+        bool m;  // parity of the path
+
+        var_index x;
+
+        std::uint8_t next;  // cofactor to be visited next (2 if both have been visited)
+    };
+
+    auto visit(Edge const& g, bool m) -> bool  // Has a solution been reached?
+    {
+        m = m != g->weight();
+        if (g->is_const())
+        {
+            return leaf(g, m);
+        }
+
+        auto const x = g->ch()->br().x;
+        auto [lo, hi] = cof(g);
+        path.push_back({.lo = std::move(lo), .hi = std::move(hi), .m = m, .x = x, .next = 0});
+        return false;
+    }
+
+    auto advance() -> void
+    {
+        while (!path.empty())
+        {
+            auto& top = path.back();
+            if (top.next == 2)
+            {
+                cur[top.x].reset();
+                path.pop_back();
+                continue;
+            }
+
+            auto const a = top.next++ == 1;
+            cur[top.x] = a;
+            auto const g = a ? top.hi : top.lo;  // copy as visiting can reallocate the path
+            if (visit(g, top.m))
+            {
+                return;
+            }
+        }
+        done = true;
+    }
+
+    Edge f;
+
+    cube cur;
+
+    std::vector<frame> path;
+
+    Cofactor cof;
+
+    Leaf leaf;
+
+    bool started{};
+
+    bool done{};
+};
+
+}  // namespace freddy::detail
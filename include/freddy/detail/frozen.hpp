@@ -0,0 +1,63 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include <array>    // std::array
+#include <cstdint>  // std::uint32_t
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy::detail
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// A frozen image consists of the header, the variable order (var_count entries), the roots (root_count edges), and the
+// nodes (node_count entries) bottom-up by level. Index 0 is the 0-leaf and edges are encoded as (index << 1) | weight,
+// so that the image is position-independent and can be used directly after mapping it into memory.
+
+struct frozen_header final
+{
+    std::array<char, 8> magic;
+
+    std::uint32_t version;
+
+    std::uint32_t endianness;  // marker in the byte order of the writing platform
+
+    std::uint32_t var_count;
+
+    std::uint32_t root_count;
+
+    std::uint32_t node_count;  // including the 0-leaf
+
+    std::uint32_t reserved;  // for future use (0)
+};
+
+struct frozen_node final
+{
+    std::uint32_t x;  // variable index
+
+    std::uint32_t hi;  // encoded edge to a node with a smaller index
+
+    std::uint32_t lo;  // encoded edge to a node with a smaller index
+};
+
+static_assert(sizeof(frozen_header) == 32 && sizeof(frozen_node) == 12, "frozen images must not contain padding");
+
+// =====================================================================================================================
+// Constants
+// =====================================================================================================================
+
+inline constexpr std::array<char, 8> frozen_magic{'F', 'R', 'E', 'D', 'D', 'Y', 'F', 'Z'};
+
+inline constexpr std::uint32_t frozen_version = 1;
+
+inline constexpr std::uint32_t frozen_endianness = 0x0102'0304;
+
+}  // namespace freddy::detail
@@ -16,23 +16,31 @@
 #include "freddy/expansion.hpp"                   // to_string
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>       // boost::intrusive_ptr
+#include <boost/unordered/unordered_flat_map.hpp>  // boost::unordered_flat_map
 #include <boost/unordered/unordered_flat_set.hpp>  // boost::unordered::erase_if
 
 #include <algorithm>    // std::ranges::fold_left
 #include <array>        // std::array
+#include <bit>          // std::countr_zero
 #include <cassert>      // assert
+#include <chrono>       // std::chrono::steady_clock
 #include <cmath>        // std::ceil
 #include <concepts>     // std::same_as
 #include <cstddef>      // std::size_t
+#include <cstdint>      // std::uint8_t
 #include <format>       // std::format
+#include <istream>      // std::istream
 #include <limits>       // std::numeric_limits
 #include <memory>       // std::unique_ptr
+#include <optional>     // std::optional
 #include <ostream>      // std::ostream
 #include <ranges>       // std::views::iota
-#include <stdexcept>    // std::overflow_error
+#include <span>         // std::span
+#include <stdexcept>    // std::invalid_argument
 #include <string>       // std::string
 #include <string_view>  // std::string_view
 #include <type_traits>  // std::is_base_of_v
+#include <typeinfo>     // typeid
 #include <utility>      // std::pair
 #include <vector>       // std::vector
 
@@ -153,6 +161,32 @@ class manager
         return vlist.size();
     }
 
+    [[nodiscard]] auto level(var_index const x) const noexcept
+    {
+        assert(x < var_count());
+
+        return var2lvl[x];
+    }
+
+    [[nodiscard]] auto label(var_index const x) const noexcept -> std::string_view
+    {
+        assert(x < var_count());
+
+        return vlist[x].label();
+    }
+
+    [[nodiscard]] auto decomposition(var_index const x) const noexcept  // direct access to variables is not allowed
+    {
+        assert(x < var_count());
+
+        return vlist[x].decomposition();
+    }
+
+    [[nodiscard]] auto order() const noexcept -> std::vector<var_index> const&
+    {  // variable of each level
+        return lvl2var;
+    }
+
     [[nodiscard]] auto const_count() const noexcept
     {
         return ntable.size();
@@ -165,6 +199,16 @@ class manager
                const_count();
     }
 
+    [[nodiscard]] auto gc_count() const noexcept  // garbage collections so far
+    {
+        return gc_runs;
+    }
+
+    [[nodiscard]] auto dyn_reorder_count() const noexcept  // reorderings triggered at safe points so far
+    {
+        return dyn_reorders;
+    }
+
     [[nodiscard]] auto edge_count() const noexcept
     {
         return std::ranges::fold_left(vlist, 0uz,
@@ -179,17 +223,127 @@ class manager
 
         sift(lvl_x, lvl_y);  // from x to y
         sift(lvl_x < lvl_y ? lvl_y - 1 : lvl_y + 1, lvl_x);
+
+        reordered();
+    }
+
+    auto permute(std::span<var_index const> const new_lvl2var)
+    {  // establishes the given order with the minimum number of level exchanges, so that DDs remain in place
+        assert(new_lvl2var.size() == var_count());
+        assert(std::ranges::is_permutation(new_lvl2var, lvl2var));
+
+        std::vector<bool> closed(var_count());  // groups whose levels have been passed
+        for (auto lvl = 1uz; lvl < new_lvl2var.size(); ++lvl)
+        {
+            auto const prev_grp = var2grp[new_lvl2var[lvl - 1]];
+            auto const grp = var2grp[new_lvl2var[lvl]];
+            if (grp != prev_grp)
+            {
+                closed[prev_grp] = true;
+                if (closed[grp])
+                {
+                    throw std::invalid_argument{"The order splits a variable group."};
+                }
+            }
+        }
+
+        gc();  // as level exchanges only clean up locally
+        for (auto const lvl : std::views::iota(0u, static_cast<var_index>(var_count())))
+        {  // top-down, whereby the remaining variables keep their relative order
+            sift(var2lvl[new_lvl2var[lvl]], lvl);
+        }
+
+        reordered();
+    }
+
+    auto reorder(reorder_method const m = reorder_method::SIFT)
+    {
+        if (m == reorder_method::DTL_SIFT)
+        {  // decomposition types are considered as well
+            if (!supports_dtl())
+            {
+                throw std::invalid_argument{"DTL sifting is not supported by this DD type."};
+            }
+            dtl_sift({});
+            return;
+        }
+
+        gc();  // as level exchanges only clean up locally
+        start_reordering();
+
+        switch (m)
+        {
+            case reorder_method::NONE: break;
+            case reorder_method::SIFT: group_sift(); break;
+            case reorder_method::SIFT_CONV: group_sift(true); break;
+            case reorder_method::SYMM_SIFT: symm_sift(); break;
+            case reorder_method::WINDOW2: window(2); break;
+            case reorder_method::WINDOW3: window(3); break;
+            case reorder_method::WINDOW4: window(4); break;
+            case reorder_method::EXACT: exact(); break;
+            default: assert(false); std::unreachable();
+        }
+
+        reordered();
+    }
+
+    auto reorder_parallel(std::vector<reorder_method> const& ms)
+    {  // candidate methods are tried simultaneously in clones of this manager, whereupon the best order is adopted
+        assert(!ms.empty());
+
+        if (std::ranges::any_of(ms, [](reorder_method const m) { return m == reorder_method::DTL_SIFT; }))
+        {  // only the order is adopted, i.e., decomposition types changed by a clone would be lost
+            throw std::invalid_argument{"DTL sifting cannot be run in parallel."};
+        }
+
+        gc();  // so that only living DDs are cloned
+        std::vector<std::pair<std::unique_ptr<manager>, std::vector<edge_ptr>>> workers;  // (manager, roots)
+        workers.reserve(ms.size());
+        for (auto i = 0uz; i < ms.size(); ++i)
+        {  // sequentially, as reference counts are not thread-safe
+            workers.push_back(clone());
+        }
+
+        parallel_for(0uz, ms.size(), [&ms, &workers](std::size_t const i) { workers[i].first->reorder(ms[i]); });
+
+        auto const& best = std::ranges::min_element(workers, {}, [](auto const& worker) {
+                               return worker.first->node_count();
+                           })->first;
+        if (best->node_count() < node_count())
+        {
+            permute(best->order());
+        }
+    }
+
+    auto group(std::vector<var_index> const& xs)
+    {  // variables must occupy contiguous levels, which are then kept together during reordering
+        assert(!xs.empty());
+
+        auto const [min_lvl, max_lvl] = std::ranges::minmax(xs | std::views::transform([this](var_index const x) {
+                                                                 assert(x < var_count());
+                                                                 return var2lvl[x];
+                                                             }));
+        assert(max_lvl - min_lvl + 1 == xs.size());  // contiguous block without duplicates
+
+        // existing groups overlapping the block are merged
+        auto const first = block(min_lvl).first;
+        auto const last = block(max_lvl).first + block(max_lvl).second;
+        auto const grp = std::ranges::min(std::views::iota(first, last) |
+                                          std::views::transform([this](var_index const lvl) { return lvl2var[lvl]; }));
+        for (auto const lvl : std::views::iota(first, last))
+        {
+            var2grp[lvl2var[lvl]] = grp;
+        }
     }
 
-    auto reorder()
+    auto ungroup(var_index const x)
     {
-        std::pair<var_index, decltype(node_count())> min{{}, node_count()};  // (level, nodes)
-        for (auto const lvl : var2lvl)
+        assert(x < var_count());
+
+        auto const [lvl, n] = block(var2lvl[x]);
+        for (auto const i : std::views::iota(lvl, lvl + n))
         {
-            min.first = lvl;                      // at which the minimum number of nodes was recorded
-            auto stop_lvl = sift_down(lvl, min);  // taking into account max_node_growth
-            stop_lvl = sift_up(stop_lvl, min);
-            sift(stop_lvl, min.first);  // move the variable to the position of the local minimum
+            var2grp[lvl2var[i]] = lvl2var[i];  // each variable forms its own group
         }
     }
 
@@ -198,12 +352,6 @@ class manager
     {
         ct.clear();  // to avoid invalid results
 
-        auto cleanup = [](auto& ut) {
-            boost::unordered::erase_if(ut, [](auto const& item) {  // using an anti-drift mechanism
-                return item->is_dead();
-            });
-        };
-
         for (auto const x : lvl2var)
         {  // an increased chance of deleting edges/nodes
             cleanup(vlist[x].etable);
@@ -213,6 +361,9 @@ class manager
         // constants
         cleanup(etable);
         cleanup(ntable);
+
+        ncount = node_count();  // only living nodes remain
+        ++gc_runs;
     }
 
     // identity-oriented
@@ -336,6 +487,26 @@ class manager
         return var2lvl[x] >= var2lvl[y];
     }
 
+    // must not be called during a (recursive) DD operation since it may change the variable order
+    auto safe_point()
+    {
+        if (!reorder_due)
+        {  // node growth is moderate
+            return;
+        }
+        reorder_due = false;
+
+        gc();  // as only living nodes are relevant
+        if (node_count() <= reorder_thresh())
+        {  // as many nodes must be created again before the next check so that GCs do not thrash
+            next_check = node_count() + reorder_thresh();
+            return;
+        }
+
+        reorder(cfg.dyn_reorder);
+        ++dyn_reorders;
+    }
+
     // ---- Methods for Overriding and/or Wrapping by DD Types ---------------------------------------------------------
 
     // aggregates an edge weight and a node value
@@ -362,6 +533,30 @@ class manager
 
     [[nodiscard]] virtual auto regw() const -> EWeight = 0;  // returns the regular weight of an edge
 
+    // creates an empty manager of the same DD type with the same configuration
+    [[nodiscard]] virtual auto spawn() const -> std::unique_ptr<manager> = 0;
+
+    virtual auto dump_dot_const(NValue const& c, out_buffer& out) const -> void  // attributes of constant nodes
+    {
+        (out << "shape=box,style=filled,color=chocolate,fontcolor=white,label=\"").put(c) << '"';
+    }
+
+    [[nodiscard]] virtual auto is_normal(NValue const&) const -> bool  // Can a constant node have this value?
+    {
+        return true;
+    }
+
+    // Can decomposition types be changed by DTL sifting? Not for DD types whose nodes must remain Shannon nodes.
+    [[nodiscard]] virtual auto supports_dtl() const noexcept -> bool
+    {
+        return false;
+    }
+
+    [[nodiscard]] virtual auto weighted() const noexcept -> bool  // Do edge weights carry information?
+    {
+        return true;
+    }
+
     virtual auto apply(EWeight const& w, edge_ptr const& f) -> edge_ptr  // optimizations vary depending on the DD type
     {
         assert(f);
@@ -369,42 +564,18 @@ class manager
         return uedge(comb(w, f->w), f->v);
     }
 
-    // handling bit-level DDs with edge weight inversion for nD transitions
-    virtual auto change_decomposition(var_index const x, expansion const t) -> void  // at the bottom variable level
+    // handling bit-level DDs by rewriting the nodes of x locally, whereby the variable can be at any level
+    virtual auto change_decomposition(var_index const x, expansion const t) -> void
     {
         assert(x < var_count());
-        assert(var2lvl[x] == var_count() - 1);
-        assert(vlist[x].ntable.size() == 1);
 
-        auto const orig_t = vlist[x].t;
-        if (orig_t == t)
+        if (vlist[x].t == t)
         {  // variable already has the desired decomposition type
             return;
         }
 
         gc();  // for performance reasons
-
-        // Edge adjustments are only necessary when changing from or to nD.
-        if (t == expansion::nD || orig_t == expansion::nD)
-        {  // invert all edges pointing to the node at this level
-            std::vector<edge_ptr> tmp;
-            tmp.reserve(vlist[x].etable.size());
-
-            for (auto it = vlist[x].etable.begin(); it != vlist[x].etable.end();)
-            {
-                auto const e = *it;
-                it = vlist[x].etable.erase(it);
-
-                e->w = !e->w;
-                tmp.push_back(std::move(e));
-            }
-
-            vlist[x].etable.insert(tmp.begin(), tmp.end());
-        }
-
-        vlist[x].t = t;
-
-        gc();
+        rewrite_level(x, t);
     }
 
     virtual auto cof(edge_ptr const& f, var_index const x, bool const a) -> edge_ptr  // edge weights could be factored
@@ -447,9 +618,14 @@ class manager
             throw std::overflow_error{"The maximum number of supported variables has been reached. "
                                       "Consider changing the variable encoding."};
         }
+        if (cfg.dyn_reorder == reorder_method::DTL_SIFT && !supports_dtl())
+        {  // checked here, as the constructor of this base class cannot query the DD type
+            throw std::invalid_argument{"DTL sifting is not supported by this DD type."};
+        }
 
         auto const x = static_cast<var_index>(var_count());
 
+        var2grp.push_back(x);
         var2lvl.push_back(x);
         lvl2var.push_back(x);
         vlist.emplace_back(t, lbl.empty() ? "x"s + std::to_string(x) : lbl, cfg.utable_size_hint);
@@ -463,6 +639,7 @@ class manager
             vars.push_back(uedge(regw(), unode(x, consts[1], consts[0])));
         }
 
+        assert(var2grp.size() == var_count());
         assert(var2lvl.size() == var_count());
         assert(lvl2var.size() == var_count());
         assert(vars.size() == var_count());
@@ -477,13 +654,6 @@ class manager
         return vars[x];
     }
 
-    [[nodiscard]] auto decomposition(var_index const x) const noexcept  // direct access to variables is not allowed
-    {
-        assert(x < var_count());
-
-        return vlist[x].decomposition();
-    }
-
     auto constant(EWeight w, NValue c, bool const keep_alive)
     {
         if (keep_alive)
@@ -589,6 +759,16 @@ class manager
         return cache(std::move(op))->get_result();
     }
 
+    [[nodiscard]] auto support(edge_ptr const& f) const  // indexed by variable
+    {
+        assert(f);
+
+        boost::unordered_flat_set<node*, hash, equal> marks;
+        std::vector<bool> xs(var_count());
+        support(f, marks, xs);
+        return xs;
+    }
+
     [[nodiscard]] auto is_essential(edge_ptr const& f, var_index const x) const noexcept -> bool
     {
         assert(f);
@@ -728,221 +908,1227 @@ class manager
         };
 
         gc();
+        start_reordering();
+
+        std::optional<dtl_refs> refs;  // if DDs are given, only the nodes reachable from them are counted
+        if (!fs.empty())
+        {
+            refs.emplace();
+            for (auto const& f : fs)
+            {
+                assert(f);
+
+                dtl_count(f, *refs);
+            }
+        }
 
         std::vector<var_index> tmp_vars(var_count());
         for (var_index x = 0; x < var_count(); ++x)
         {
             tmp_vars[x] = x;
         }
-        gc();
         std::ranges::sort(tmp_vars, comp_largest_layer);
-        for (var_index i = 0; i < var_count(); ++i)
+        for (var_index i = 0; i < var_count() && !budget_exhausted(); ++i)
         {
-            dtl_sift_single_var(tmp_vars[i], fs);
+            if (block(var2lvl[tmp_vars[i]]).second == 1)
+            {  // grouped variables keep their position and decomposition type
+                dtl_sift_single_var(tmp_vars[i], refs);
+            }
         }
         gc();
+
+        reordered();
     }
 
+    // iterative and levelized, so that even huge DDs can be exported without deep recursions or intermediate strings
     auto dump_dot(std::vector<edge_ptr> const& fs, std::vector<std::string> const& outputs, std::ostream& os) const
     {
         assert(outputs.empty() ? true : outputs.size() == fs.size());
 
-        os << "digraph DD {\n";
-        os << "f [style=invis];\n";
-        os << "c [style=invis];\n";
+        out_buffer out{os};
+        out << "digraph DD {\n";
+        out << "f [style=invis];\n";
+        out << "c [style=invis];\n";
 
         if (var_count() == 0)
         {
-            os << "f -> c [style=invis];\n";
+            out << "f -> c [style=invis];\n";
         }
         for (auto i = 0uz; i < lvl2var.size(); ++i)  // arrange nodes per level
         {
             if (i == 0)
             {
-                os << "f -> x" << lvl2var[i] << " [style=invis];\n";
+                out << "f -> x" << lvl2var[i] << " [style=invis];\n";
             }
 
-            os << 'x' << lvl2var[i] << R"( [shape=plaintext,fontname="times italic",label=")" << lvl2var[i] << " ["
-               << to_string(vlist[lvl2var[i]].t) << "]\"];\n";
+            out << 'x' << lvl2var[i] << R"( [shape=plaintext,fontname="times italic",label=")" << lvl2var[i] << " ["
+                << to_string(vlist[lvl2var[i]].t) << "]\"];\n";
 
             if (i + 1 < var_count())
             {  // There will be one more iteration.
-                os << 'x' << lvl2var[i] << " -> x" << lvl2var[i + 1] << " [style=invis];\n";
+                out << 'x' << lvl2var[i] << " -> x" << lvl2var[i + 1] << " [style=invis];\n";
             }
             else
             {
-                os << 'x' << lvl2var[i] << " -> c [style=invis];\n";
+                out << 'x' << lvl2var[i] << " -> c [style=invis];\n";
             }
         }
 
-        boost::unordered_flat_set<node*, hash, equal> marks;
-        marks.reserve(cfg.utable_size_hint);
-
+        auto weight = [this, &out](edge_ptr const& e) {
+            if (weighted())
+            {
+                (out << ",label=\" ").put(e->w) << " \"";
+            }
+            out << "];\n";
+        };
         for (auto i = 0uz; i < fs.size(); ++i)
         {
             assert(fs[i]);
 
             auto const func = "f"s + std::to_string(i);  // to prevent overwriting identical functions
 
-            os << func << R"( [shape=plaintext,fontname="times bold",label=")" << (outputs.empty() ? func : outputs[i])
-               << "\"]\n";
-            os << "{ rank=same; f; " << func << "; }\n";
-            os << func << " -> v" << fs[i]->v << " [label=\" " << fs[i]->w << " \"];\n";
-
-            dump_dot(fs[i], marks, os);
+            out << func << R"( [shape=plaintext,fontname="times bold",label=")" << (outputs.empty() ? func : outputs[i])
+                << "\"]\n";
+            out << "{ rank=same; f; " << func << "; }\n";
+            out << func << " -> v" << fs[i]->v.get() << " [dir=forward";
+            weight(fs[i]);
         }
 
-        os << "}\n";
-    }
-
-  private:
-    using computed_table = boost::unordered_flat_set<std::unique_ptr<operation>, hash, equal>;  // CT
-
-    struct dtl_sift_result
-    {
-        var_index x;
-
-        var_index pos;
-
-        std::size_t size;
+        auto const lvls = levelize(fs);
+        for (auto i = 0uz; i < var_count(); ++i)
+        {
+            auto const x = lvl2var[i];
+            if (lvls[i].empty())
+            {
+                continue;
+            }
 
-        expansion exp;
-    };
+            out << "{ rank=same; x" << x;
+            for (auto const* const v : lvls[i])
+            {
+                out << "; v" << v;
+            }
+            out << "; }\n";
+            for (auto const* const v : lvls[i])
+            {
+                out << 'v' << v << " [shape=" << (vlist[x].t == expansion::S ? "circle" : "octagon,regular=true")
+                    << ",style=filled,color=black,fontcolor=white,label=\"" << vlist[x].lbl << "\"];\n";
+                out << 'v' << v << " -> v" << v->inner.hi->v.get() << " [color=blue,dir=none";
+                weight(v->inner.hi);
+                out << 'v' << v << " -> v" << v->inner.lo->v.get() << " [style=dashed,color=red,dir=none";
+                weight(v->inner.lo);
+            }
+        }
+        for (auto const* const v : lvls.back())
+        {
+            out << 'v' << v << " [";
+            dump_dot_const(v->outer, out);
+            out << "];\n";
+            out << "{ rank=same; c; v" << v << "; }\n";
+        }
 
-    [[nodiscard]] auto depth(edge_ptr const& f) const noexcept -> var_index
-    {
-        return f->is_const() ? 1 : std::max(depth(f->v->inner.hi), depth(f->v->inner.lo)) + 1;
+        out << "}\n";
     }
 
-    auto dtl_find_smallest_level(dtl_sift_result const& curr_best, expansion const exp, std::vector<edge_ptr> const& fs)
+    // Format: "c <id> <value>" per constant, "n <id> <var> <hi> <hi weight> <lo> <lo weight>" per inner node, and
+    // "r <id> <weight>" per root. Nodes are listed bottom-up by level, i.e., successors are always defined first.
+    auto dump_edge_list(std::vector<edge_ptr> const& fs, std::ostream& os) const
     {
-        auto res = curr_best;
-        auto const x = curr_best.x;
-        sift(var2lvl[x], static_cast<var_index>(var_count() - 1));  // move to the bottom
-        change_decomposition(x, exp);
-        auto const exceeding_size = static_cast<double>(dtl_get_size(fs)) * cfg.max_node_growth;
-        for (auto i = var2lvl[x]; i > 0; --i)
+        auto const lvls = levelize(fs);
+        boost::unordered_flat_map<node const*, std::size_t> ids;
+        ids.reserve(
+            std::ranges::fold_left(lvls, 0uz, [](auto const sum, auto const& lvl) { return sum + lvl.size(); }));
+
+        out_buffer out{os};
+        for (auto const& lvl : lvls | std::views::reverse)
         {
-            sift(i, i - 1);
-            gc();
-            auto const current_size = dtl_get_size(fs);
-            if (static_cast<double>(current_size) > exceeding_size)
+            for (auto const* const v : lvl)
             {
-                break;
-            }
-            if (current_size < res.size)
-            {
-                res.size = current_size;
-                res.pos = var2lvl[x];
-                res.exp = vlist[x].t;
+                auto const id = ids.size();
+                ids.emplace(v, id);
+                if (v->is_const())
+                {
+                    (out << "c " << id << ' ').put(v->outer) << '\n';
+                    continue;
+                }
+                auto const& br = v->inner;
+                (out << "n " << id << ' ' << br.x << ' ' << ids.at(br.hi->v.get()) << ' ').put(br.hi->w) << ' ';
+                (out << ids.at(br.lo->v.get()) << ' ').put(br.lo->w) << '\n';
             }
         }
-        return res;
+        for (auto const& f : fs)
+        {
+            (out << "r " << ids.at(f->v.get()) << ' ').put(f->w) << '\n';
+        }
     }
 
-    [[nodiscard]] auto dtl_get_size(std::vector<edge_ptr> const& fs) const
+    [[nodiscard]] auto levelize(std::vector<edge_ptr> const& fs) const  // reachable nodes per level (constants last)
     {
-        if (fs.empty())
-        {
-            return node_count();
+        std::vector<std::vector<node const*>> lvls(var_count() + 1);
+        boost::unordered_flat_set<node const*> marks;
+        std::vector<node const*> stack;
+        for (auto const& f : fs)
+        {  // iteratively, as DDs can be deep
+            assert(f);
+
+            stack.push_back(f->v.get());
+            while (!stack.empty())
+            {
+                auto const* const v = stack.back();
+                stack.pop_back();
+                if (!marks.insert(v).second)
+                {
+                    continue;
+                }
+                if (v->is_const())
+                {
+                    lvls.back().push_back(v);
+                    continue;
+                }
+                lvls[var2lvl[v->inner.x]].push_back(v);
+                stack.push_back(v->inner.hi->v.get());
+                stack.push_back(v->inner.lo->v.get());
+            }
         }
-        return size(fs);
+        return lvls;
     }
 
-    auto dtl_sift_single_var(var_index const x, std::vector<edge_ptr> const& fs)
+    struct batch_step final  // node of a levelized program, whose successors are referenced by smaller IDs
     {
-        dtl_sift_result res{.x = x, .pos = var2lvl[x], .size = dtl_get_size(fs), .exp = vlist[x].t};
+        var_index x;
 
-        // find smallest level for Shannon
-        res = dtl_find_smallest_level(res, expansion::S, fs);
+        expansion t;
 
-        // find smallest level for positive Davio
-        res = dtl_find_smallest_level(res, expansion::pD, fs);
+        std::uint32_t hi, lo;
 
-        // find smallest level for negative Davio
-        res = dtl_find_smallest_level(res, expansion::nD, fs);
+        EWeight hi_w, lo_w;
+    };
 
-        // move variable to smallest level with smallest expansion type
-        sift(var2lvl[x], static_cast<var_index>(var_count() - 1));
-        change_decomposition(x, res.exp);
-        sift(var2lvl[x], res.pos);
+    struct batch_program final
+    {
+        std::vector<node const*> consts;  // IDs 0, ..., consts.size() - 1
 
-        return res;
-    }
+        std::vector<batch_step> steps;  // followed by the nodes bottom-up
+
+        std::vector<std::pair<std::uint32_t, EWeight>> roots;
+    };
 
-    auto dump_dot(edge_ptr const& f, boost::unordered_flat_set<node*, hash, equal>& marks, std::ostream& os) const
+    [[nodiscard]] auto batch_compile(std::vector<edge_ptr> const& fs) const
     {
-        if (!marks.insert(f->v.get()).second)
+        auto const lvls = levelize(fs);
+        boost::unordered_flat_map<node const*, std::uint32_t> ids;
+        batch_program prog;
+        for (auto const* const v : lvls.back())
         {
-            return;
+            ids.emplace(v, static_cast<std::uint32_t>(ids.size()));
+            prog.consts.push_back(v);
         }
-
-        if (f->is_const())
+        for (auto const& lvl : lvls | std::views::take(var_count()) | std::views::reverse)
         {
-            os << 'v' << f->v << " [shape=box,style=filled,color=chocolate,fontcolor=white,label=\"" << f->v->outer
-               << "\"];\n";
-            os << "{ rank=same; c; v" << f->v << "; }\n";
-
-            return;
+            for (auto const* const v : lvl)
+            {
+                ids.emplace(v, static_cast<std::uint32_t>(ids.size()));
+                prog.steps.push_back({.x = v->inner.x,
+                                      .t = vlist[v->inner.x].t,
+                                      .hi = ids.at(v->inner.hi->v.get()),
+                                      .lo = ids.at(v->inner.lo->v.get()),
+                                      .hi_w = v->inner.hi->w,
+                                      .lo_w = v->inner.lo->w});
+            }
         }
-
-        os << 'v' << f->v << " [shape=" << (vlist[f->v->inner.x].t == expansion::S ? "circle" : "octagon,regular=true")
-           << ",style=filled,color=black,fontcolor=white,label=\"" << vlist[f->v->inner.x].lbl << "\"];\n";
-        os << "{ rank=same; x" << f->v->inner.x << "; v" << f->v << "; }\n";
-        os << 'v' << f->v << " -> v" << f->v->inner.hi->v << " [color=blue,dir=none,label=\" " << f->v->inner.hi->w
-           << " \"];\n";
-        os << 'v' << f->v << " -> v" << f->v->inner.lo->v << " [style=dashed,color=red,dir=none,label=\" "
-           << f->v->inner.lo->w << " \"];\n";
-
-        dump_dot(f->v->inner.hi, marks, os);
-        dump_dot(f->v->inner.lo, marks, os);
+        for (auto const& f : fs)
+        {
+            prog.roots.emplace_back(ids.at(f->v.get()), f->w);
+        }
+        return prog;
     }
 
-    [[nodiscard]] auto eval(node_ptr const& v, std::vector<bool> const& as) const -> NValue
+    // Bit-parallel evaluation of Boolean DDs, where bit j of as[x][k] is the value of variable x in assignment 64k + j.
+    // All nodes are evaluated once per tile of 256 to 4096 assignments in a single bottom-up pass. The loops over a
+    // tile are branch-free and can be vectorized. Without weights, complemented edges are ignored (e.g., to detect
+    // reachability).
+    template <bool Weights = true, typename Leaf>
+    [[nodiscard]] auto eval_batch(std::vector<edge_ptr> const& fs, std::vector<std::vector<std::uint64_t>> const& as,
+                                  Leaf leaf) const
     {
-        if (v->is_const())
+        assert(as.size() == var_count());
+
+        auto const words = as.empty() ? 0uz : as[0].size();
+        auto const prog = batch_compile(fs);
+        auto const count = prog.consts.size() + prog.steps.size();
+        auto const tile = std::bit_floor(std::clamp((1uz << 19) / count, 4uz, 64uz));  // words, all tiles in 4 MiB
+        auto mask = [](EWeight const& w) { return Weights && w != EWeight{} ? ~std::uint64_t{} : std::uint64_t{}; };
+
+        std::vector<std::uint64_t> vals(count * tile);
+        for (auto i = 0uz; i < prog.consts.size(); ++i)
         {
-            return v->outer;
+            std::fill_n(vals.begin() + static_cast<std::ptrdiff_t>(i * tile), tile,
+                        leaf(prog.consts[i]->outer) ? ~std::uint64_t{} : std::uint64_t{});
         }
-
-        NValue res;
-        auto const& br = v->inner;
-        switch (vlist[br.x].t)
+        std::vector<std::vector<std::uint64_t>> res(fs.size(), std::vector<std::uint64_t>(words));
+        for (auto k0 = 0uz; k0 < words; k0 += tile)
         {
-            case expansion::S:
+            auto const n = std::min(tile, words - k0);
+            auto* r = vals.data() + (prog.consts.size() * tile);
+            for (auto const& step : prog.steps)
             {
-                res = as[br.x] ? eval(br.hi, as) : eval(br.lo, as);
-                break;
+                assert(as[step.x].size() == words);
+
+                auto const* const xs = as[step.x].data() + k0;
+                auto const* const hi = vals.data() + (step.hi * tile);
+                auto const* const lo = vals.data() + (step.lo * tile);
+                auto const hm = mask(step.hi_w);
+                auto const lm = mask(step.lo_w);
+                switch (step.t)
+                {
+                    case expansion::S:
+                        for (auto k = 0uz; k < n; ++k)
+                        {
+                            r[k] = (xs[k] & (hi[k] ^ hm)) | (~xs[k] & (lo[k] ^ lm));
+                        }
+                        break;
+                    case expansion::pD:
+                        for (auto k = 0uz; k < n; ++k)
+                        {
+                            r[k] = (lo[k] ^ lm) ^ (xs[k] & (hi[k] ^ hm));
+                        }
+                        break;
+                    case expansion::nD:
+                        for (auto k = 0uz; k < n; ++k)
+                        {
+                            r[k] = (lo[k] ^ lm) ^ (~xs[k] & (hi[k] ^ hm));
+                        }
+                        break;
+                    default: assert(false); std::unreachable();
+                }
+                r += tile;
+            }
+            for (auto i = 0uz; i < fs.size(); ++i)
+            {
+                auto const* const f = vals.data() + (prog.roots[i].first * tile);
+                auto const fm = mask(prog.roots[i].second);
+                for (auto k = 0uz; k < n; ++k)
+                {
+                    res[i][k0 + k] = f[k] ^ fm;
+                }
             }
-            case expansion::pD: res = as[br.x] ? merge(eval(br.hi, as), eval(br.lo, as)) : eval(br.lo, as); break;
-            case expansion::nD: res = as[br.x] ? eval(br.lo, as) : merge(eval(br.hi, as), eval(br.lo, as)); break;
-            default: assert(false); std::unreachable();
         }
         return res;
     }
 
-    auto exchange(var_index const lvl)  // NOLINT(readability-function-cognitive-complexity)
+    // Counterpart for DDs with numeric values, which are computed for a tile of 64 assignments per node. Weights are
+    // aggregated and successors are merged by the given functions so that DD types can avoid virtual calls.
+    template <typename Agg, typename Merge>
+    [[nodiscard]] auto eval_batch(std::vector<edge_ptr> const& fs, std::vector<std::vector<std::uint64_t>> const& as,
+                                  Agg agg_w, Merge merge_v) const
     {
-        if (lvl == var_count() - 1)
-        {  // level below contains only constants
-            return;
-        }
-
-        gc();  // ensure that dead nodes are not swapped
+        assert(as.size() == var_count());
 
-        auto const x = lvl2var[lvl];
-        auto const y = lvl2var[lvl + 1];
+        constexpr auto tile = 64uz;  // assignments
+        auto const words = as.empty() ? 0uz : as[0].size();
+        auto const prog = batch_compile(fs);
 
-        auto swap_is_needed = [y](edge_ptr const& hi, edge_ptr const& lo) {
-            auto const hi_has_y = !hi->is_const() && hi->v->inner.x == y;
-            auto const lo_has_y = !lo->is_const() && lo->v->inner.x == y;
-            return hi_has_y || lo_has_y;
-        };
+        std::vector<NValue> vals((prog.consts.size() + prog.steps.size()) * tile);
+        for (auto i = 0uz; i < prog.consts.size(); ++i)
+        {
+            std::fill_n(vals.begin() + static_cast<std::ptrdiff_t>(i * tile), tile, prog.consts[i]->outer);
+        }
+        std::vector<std::vector<NValue>> res(fs.size(), std::vector<NValue>(words * tile));
+        std::array<NValue, tile> his, los;
+        for (auto k = 0uz; k < words; ++k)
+        {
+            auto* r = vals.data() + (prog.consts.size() * tile);
+            for (auto const& step : prog.steps)
+            {
+                assert(as[step.x].size() == words);
 
-        // look ahead to determine how many swaps need to be performed
-        auto const max_swaps_needed =
-            std::ranges::fold_left(vlist[x].ntable, 0uz, [swap_is_needed](std::size_t const sum, auto const& v) {
-                return swap_is_needed(v->inner.hi, v->inner.lo) ? sum + 2 : sum;  // two branches must be made per swap
+                auto const bits = as[step.x][k];
+                auto const* const hi = vals.data() + (step.hi * tile);
+                auto const* const lo = vals.data() + (step.lo * tile);
+                for (auto j = 0uz; j < tile; ++j)
+                {
+                    his[j] = step.hi_w == regw() ? hi[j] : agg_w(step.hi_w, hi[j]);
+                    los[j] = step.lo_w == regw() ? lo[j] : agg_w(step.lo_w, lo[j]);
+                }
+                for (auto j = 0uz; j < tile; ++j)
+                {
+                    auto const a = ((bits >> j) & 1u) != 0;
+                    switch (step.t)
+                    {
+                        case expansion::S: r[j] = a ? his[j] : los[j]; break;
+                        case expansion::pD: r[j] = a ? merge_v(his[j], los[j]) : los[j]; break;
+                        case expansion::nD: r[j] = a ? los[j] : merge_v(his[j], los[j]); break;
+                        default: assert(false); std::unreachable();
+                    }
+                }
+                r += tile;
+            }
+            for (auto i = 0uz; i < fs.size(); ++i)
+            {
+                auto const* const f = vals.data() + (prog.roots[i].first * tile);
+                for (auto j = 0uz; j < tile; ++j)
+                {
+                    res[i][(k * tile) + j] = agg_w(prog.roots[i].second, f[j]);
+                }
+            }
+        }
+        return res;
+    }
+
+    // Rebuilds fs in another manager, whereby each shared node is visited once (bottom-up) and turned into an ite or
+    // Davio combination of its variable and its transferred successors. Decomposition types are therefore allowed to
+    // differ, as is the DD type: Boolean DDs transfer complemented edges as NOT, whereas weights and terminal values of
+    // arithmetic DDs are multiplied in as constants.
+    template <bool Boolean, typename Manager>
+    auto transfer(std::vector<edge_ptr> const& fs, Manager& dst, var_mapping const m) const
+    {
+        using dd = decltype(dst.zero());
+
+        std::vector<var_index> xs;  // destination variables replacing the variables of this manager
+        xs.reserve(var_count());
+        if (m == var_mapping::LABEL)
+        {
+            boost::unordered_flat_map<std::string_view, var_index> lbl2var;
+            for (var_index x = 0; x < dst.var_count(); ++x)
+            {
+                lbl2var.emplace(dst.label(x), x);
+            }
+            for (auto const& var : vlist)
+            {
+                auto const it = lbl2var.find(var.label());
+                if (it == lbl2var.end())
+                {
+                    throw std::invalid_argument{"Variable \""s + std::string{var.label()} +
+                                                "\" does not exist in the destination manager."};
+                }
+                xs.push_back(it->second);
+            }
+        }
+        else
+        {
+            if (var_count() > dst.var_count())
+            {
+                throw std::invalid_argument{"The destination manager has too few variables."};
+            }
+            for (var_index x = 0; x < var_count(); ++x)
+            {
+                xs.push_back(x);
+            }
+        }
+
+        // Boolean DDs are combined by XOR, arithmetic DDs by addition
+        auto sum = [](dd const& f, dd const& g) {
+            if constexpr (Boolean)
+            {
+                return f ^ g;
+            }
+            else
+            {
+                return f + g;
+            }
+        };
+        auto diff = [](dd const& f, dd const& g) {
+            if constexpr (Boolean)
+            {
+                return f ^ g;
+            }
+            else
+            {
+                return f - g;
+            }
+        };
+        auto prod = [](dd const& f, dd const& g) {
+            if constexpr (Boolean)
+            {
+                return f & g;
+            }
+            else
+            {
+                return f * g;
+            }
+        };
+
+        boost::unordered_flat_map<node const*, dd> memo;
+        auto get = [&](edge_ptr const& f) {
+            auto const& g = memo.find(f->v.get())->second;
+            if constexpr (Boolean)
+            {
+                return f->w ? ~g : g;
+            }
+            else
+            {
+                return f->w == regw() ? g : dst.constant(agg(f->w, NValue{1})) * g;
+            }
+        };
+        for (auto const& lvl : levelize(fs) | std::views::reverse)
+        {  // constants first, then bottom-up
+            for (auto const* const v : lvl)
+            {
+                if (v->is_const())
+                {
+                    if constexpr (Boolean)
+                    {
+                        if (v->outer != NValue{})
+                        {  // e.g., the expansion node of BHDs
+                            throw std::invalid_argument{"DDs with special terminals cannot be transferred."};
+                        }
+                        memo.emplace(v, dst.zero());
+                    }
+                    else
+                    {
+                        memo.emplace(v, dst.constant(v->outer));
+                    }
+                    continue;
+                }
+
+                // the node as cofactors f1 (x = 1) and f0 (x = 0), or as one of them and d = f1 - f0
+                std::optional<dd> f1, f0, d;
+                switch (vlist[v->inner.x].t)
+                {
+                    case expansion::S:
+                        f1 = get(v->inner.hi);
+                        f0 = get(v->inner.lo);
+                        break;
+                    case expansion::pD:
+                        f0 = get(v->inner.lo);
+                        d = get(v->inner.hi);
+                        break;
+                    case expansion::nD:
+                        f1 = get(v->inner.lo);
+                        if constexpr (Boolean)
+                        {
+                            d = get(v->inner.hi);
+                        }
+                        else
+                        {
+                            d = -get(v->inner.hi);
+                        }
+                        break;
+                    default: assert(false); std::unreachable();
+                }
+
+                // ... is rebuilt according to the decomposition type of the destination variable
+                auto const x = dst.var(xs[v->inner.x]);
+                switch (dst.decomposition(xs[v->inner.x]))
+                {
+                    case expansion::S:
+                        if (!f1)
+                        {
+                            f1 = sum(*f0, *d);
+                        }
+                        if (!f0)
+                        {
+                            f0 = diff(*f1, *d);
+                        }
+                        memo.emplace(v, x.ite(*f1, *f0));
+                        break;
+                    case expansion::pD:
+                        if (!d)
+                        {
+                            d = diff(*f1, *f0);
+                        }
+                        if (!f0)
+                        {
+                            f0 = diff(*f1, *d);
+                        }
+                        memo.emplace(v, sum(*f0, prod(x, *d)));
+                        break;
+                    case expansion::nD:
+                        if (!d)
+                        {
+                            d = diff(*f1, *f0);
+                        }
+                        if (!f1)
+                        {
+                            f1 = sum(*f0, *d);
+                        }
+                        memo.emplace(v, diff(*f1, prod(~x, *d)));
+                        break;
+                    default: assert(false); std::unreachable();
+                }
+            }
+        }
+
+        std::vector<dd> gs;
+        gs.reserve(fs.size());
+        for (auto const& f : fs)
+        {
+            gs.push_back(get(f));
+        }
+        return gs;
+    }
+
+    // Format: header, variables (by index), order, constants, nodes (bottom-up by level), roots. Children are
+    // referenced relative to the current node index and everything is written in the native representation of the
+    // platform.
+    auto save(std::vector<edge_ptr> const& fs, std::ostream& os) const
+    {
+        auto const lvls = levelize(fs);
+        boost::unordered_flat_map<node const*, std::uint64_t> ids;
+        auto next_id = 0uz;
+        for (auto const& lvl : lvls | std::views::reverse)
+        {  // successors receive smaller IDs
+            for (auto const* const v : lvl)
+            {
+                ids[v] = next_id++;
+            }
+        }
+
+        os.write(magic.data(), magic.size());
+        write_varint(os, format_version);
+        write_varint(os, std::endian::native == std::endian::little ? 0 : 1);
+        std::string_view const type = typeid(*this).name();  // as DD types can share the same weights/values
+        write_varint(os, type.size());
+        os.write(type.data(), static_cast<std::streamsize>(type.size()));
+
+        write_varint(os, var_count());
+        for (auto const& var : vlist)
+        {
+            write_varint(os, static_cast<std::uint64_t>(var.t));
+            write_varint(os, var.label().size());
+            os.write(var.label().data(), static_cast<std::streamsize>(var.label().size()));
+        }
+        for (auto const x : lvl2var)
+        {
+            write_varint(os, x);
+        }
+
+        write_varint(os, lvls.back().size());
+        for (auto const* const v : lvls.back())
+        {
+            write_bin(os, v->value());
+        }
+        for (auto const& lvl : lvls | std::views::reverse | std::views::drop(1))
+        {
+            write_varint(os, lvl.size());
+            for (auto const* const v : lvl)
+            {
+                auto const id = ids[v];
+                for (auto const* const e : {&v->inner.hi, &v->inner.lo})
+                {
+                    write_bin(os, (*e)->w);
+                    write_varint(os, id - ids[(*e)->v.get()]);
+                }
+            }
+        }
+
+        write_varint(os, fs.size());
+        for (auto const& f : fs)
+        {
+            write_bin(os, f->w);
+            write_varint(os, next_id - ids[f->v.get()]);
+        }
+    }
+
+    // Missing variables are created and the stored order is established. Nodes are rebuilt by branch, as a corrupt file
+    // may contain nodes that violate the normal form of the DD type.
+    auto load(std::istream& is) -> std::vector<edge_ptr>
+    {
+        auto check = [&is](bool const cond = true) {
+            if (!is || !cond)
+            {
+                throw std::runtime_error{"The DD file is corrupt or was written by another DD type/platform."};
+            }
+        };
+        // Counts are not trusted to allocate upfront, as they would cause bad_alloc if the file is corrupt. Containers
+        // grow with the data actually read instead, and reservations are limited.
+        auto hint = [](std::uint64_t const count) { return static_cast<std::size_t>(std::min(count, max_hint)); };
+        auto read_str = [&is](std::string& str, std::uint64_t len) {
+            str.clear();
+            std::array<char, 256> chunk{};
+            while (len > 0 && is)
+            {
+                auto const m = std::min<std::uint64_t>(len, chunk.size());
+                is.read(chunk.data(), static_cast<std::streamsize>(m));
+                str.append(chunk.data(), static_cast<std::size_t>(is.gcount()));
+                len -= m;
+            }
+        };
+
+        std::array<char, magic.size()> buf{};
+        is.read(buf.data(), buf.size());
+        check(buf == magic && read_varint(is) == format_version);
+        check(read_varint(is) == (std::endian::native == std::endian::little ? 0 : 1));
+        std::string_view const type = typeid(*this).name();
+        auto const len = read_varint(is);
+        check(len == type.size());
+        std::string str(type.size(), '\0');
+        is.read(str.data(), static_cast<std::streamsize>(str.size()));
+        check(str == type);
+
+        auto const n = read_varint(is);
+        check(n >= var_count() && n <= std::numeric_limits<var_index>::max());
+        for (auto x = 0uz; x < n; ++x)
+        {
+            auto const t = read_varint(is);
+            read_str(str, read_varint(is));
+            check(t <= static_cast<std::uint64_t>(expansion::nD));
+            if (x < var_count())
+            {  // existing variables are identified by their index
+                check(vlist[x].t == static_cast<expansion>(t));
+            }
+            else
+            {
+                var(static_cast<expansion>(t), str);
+            }
+        }
+        std::vector<var_index> order(n);
+        for (auto& x : order)
+        {
+            x = static_cast<var_index>(read_varint(is));
+        }
+        check(std::ranges::is_permutation(order, lvl2var));
+        if (order != lvl2var)
+        {
+            permute(order);
+        }
+
+        std::vector<edge_ptr> vs;  // by ID, with the regular weight
+        auto const consts_count = read_varint(is);
+        vs.reserve(hint(consts_count));
+        for (auto i = 0uz; i < consts_count; ++i)
+        {
+            auto c = read_bin<NValue>(is);
+            check(is_normal(c));
+            vs.push_back(uedge(regw(), unode(std::move(c))));
+        }
+        auto child = [this, &is, &vs, &check](std::uint64_t const id) {
+            auto w = read_bin<EWeight>(is);
+            auto const delta = read_varint(is);
+            check(delta > 0 && delta <= id && (weighted() || w == regw()));
+            return apply(w, vs[id - delta]);
+        };
+        auto lvl = [this](edge_ptr const& e) { return e->is_const() ? var_count() : var2lvl[e->v->inner.x]; };
+        for (auto const x : lvl2var | std::views::reverse)
+        {  // bottom-up, so that successors already exist
+            auto const count = read_varint(is);
+            check();
+            vlist[x].ntable.reserve(vlist[x].ntable.size() + hint(count));
+            vs.reserve(vs.size() + hint(count));
+            for (auto i = 0uz; i < count; ++i)
+            {
+                auto const id = vs.size();
+                auto hi = child(id);
+                auto lo = child(id);
+                check(var2lvl[x] < lvl(hi) && var2lvl[x] < lvl(lo));
+                vs.push_back(branch(x, std::move(hi), std::move(lo)));
+            }
+        }
+
+        std::vector<edge_ptr> fs;
+        auto const roots_count = read_varint(is);
+        fs.reserve(hint(roots_count));
+        for (auto i = 0uz; i < roots_count; ++i)
+        {
+            fs.push_back(child(vs.size()));
+        }
+        return fs;
+    }
+
+  private:
+    using computed_table = boost::unordered_flat_set<std::unique_ptr<operation>, hash, equal>;  // CT
+
+    static constexpr std::array<char, 6> magic{'F', 'R', 'E', 'D', 'D', 'Y'};  // of files containing DDs
+
+    static constexpr std::uint64_t format_version = 1;
+
+    static constexpr std::uint64_t max_hint = 1uz << 20u;  // of reservations based on counts read from a file
+
+    using dtl_refs = boost::unordered_flat_map<node const*, std::size_t>;  // references from reachable nodes/roots
+
+    struct dtl_sift_result
+    {
+        var_index x;
+
+        var_index pos;
+
+        std::size_t size;
+
+        expansion exp;
+    };
+
+    [[nodiscard]] auto block(var_index const lvl) const noexcept
+    {  // (first level, #variables) of the group to which the variable at the given level belongs
+        assert(lvl < var_count());
+
+        auto const grp = var2grp[lvl2var[lvl]];
+        auto first = lvl;
+        while (first > 0 && var2grp[lvl2var[first - 1]] == grp)
+        {
+            --first;
+        }
+        auto last = lvl;
+        while (last + 1 < var_count() && var2grp[lvl2var[last + 1]] == grp)
+        {
+            ++last;
+        }
+        return std::pair{first, static_cast<var_index>(last - first + 1)};
+    }
+
+    [[nodiscard]] auto blocks() const
+    {  // groups (by index) in the current order
+        std::vector<var_index> grps;
+        for (var_index lvl = 0; lvl < var_count(); lvl += block(lvl).second)
+        {
+            grps.push_back(var2grp[lvl2var[lvl]]);
+        }
+        return grps;
+    }
+
+    [[nodiscard]] auto budget_exhausted() const noexcept
+    {  // of the current reordering
+        if (cfg.max_swaps && swap_count >= *cfg.max_swaps)
+        {
+            return true;
+        }
+        return cfg.max_reorder_time && std::chrono::steady_clock::now() - reorder_start >= *cfg.max_reorder_time;
+    }
+
+    template <class T>
+    static auto cleanup(unique_table<T>& ut) noexcept(std::is_nothrow_destructible_v<T>)
+    {
+        return boost::unordered::erase_if(ut, [](auto const& item) {  // using an anti-drift mechanism
+            return item->is_dead();
+        });
+    }
+
+    auto clone() -> std::pair<std::unique_ptr<manager>, std::vector<edge_ptr>>
+    {  // structural copy of all DDs, which is only valid as long as their roots are referenced
+        assert(node_count() == ncount);  // no dead nodes
+
+        auto dst = spawn();
+        for (auto const& var : vlist)
+        {
+            dst->var(var.t, var.label());
+        }
+        dst->lvl2var = lvl2var;  // as the UTs do not yet contain any nodes except for projections
+        dst->var2grp = var2grp;
+        dst->var2lvl = var2lvl;
+
+        boost::unordered_flat_map<node const*, node_ptr> nodes;  // source -> copy
+        boost::unordered_flat_map<edge const*, edge_ptr> edges;
+        boost::unordered_flat_map<edge const*, ref_count> inner_refs;  // references from nodes
+        auto copy_edges = [&dst, &nodes, &edges](auto const& et) {
+            for (auto const& e : et)
+            {
+                edges.emplace(e.get(), dst->uedge(e->w, nodes.at(e->v.get())));
+            }
+        };
+
+        for (auto const& c : ntable)
+        {
+            nodes.emplace(c.get(), dst->unode(c->value()));
+        }
+        copy_edges(etable);
+        for (auto lvl = var_count(); lvl-- > 0;)
+        {  // bottom-up, so that the children of a node have already been copied
+            auto const x = lvl2var[lvl];
+            for (auto const& v : vlist[x].ntable)
+            {
+                ++inner_refs[v->inner.hi.get()];
+                ++inner_refs[v->inner.lo.get()];
+                nodes.emplace(v.get(), dst->unode(x, edges.at(v->inner.hi.get()), edges.at(v->inner.lo.get())));
+            }
+            copy_edges(vlist[x].etable);
+        }
+
+        std::vector<edge_ptr> roots;  // edges referenced from outside, e.g., by DD handles
+        for (auto const& [e, copy] : edges)
+        {
+            if (e->ref - 1 > inner_refs[e])
+            {  // not only by the UT and its parents
+                roots.push_back(copy);
+            }
+        }
+        return {std::move(dst), std::move(roots)};
+    }
+
+    [[nodiscard]] auto depth(edge_ptr const& f) const noexcept -> var_index
+    {
+        return f->is_const() ? 1 : std::max(depth(f->v->inner.hi), depth(f->v->inner.lo)) + 1;
+    }
+
+    auto dtl_change(var_index const x, expansion const t, std::optional<dtl_refs>& refs)
+    {  // like rewrite_level, whereby only the successors of the nodes of x are recounted
+        if (vlist[x].t == t)
+        {
+            return;
+        }
+        if (!refs)
+        {  // #nodes is tracked by rewrite_level anyway
+            rewrite_level(x, t);
+            return;
+        }
+
+        for (auto const& v : vlist[x].ntable)
+        {
+            if (refs->contains(v.get()))
+            {
+                dtl_uncount(v->inner.hi, *refs);
+                dtl_uncount(v->inner.lo, *refs);
+            }
+        }
+
+        // Above x, the same functions remain reachable, but they may be represented by other (normalized) nodes.
+        auto const repl = rewrite_level(x, t);
+        std::vector<std::pair<node const*, std::size_t>> moved;  // in two phases, as addresses may have been reused
+        for (auto const& [v, n] : repl)
+        {
+            if (auto const it = refs->find(v); it != refs->end())
+            {
+                moved.emplace_back(n, it->second);
+                refs->erase(it);
+            }
+        }
+        for (auto const& [n, count] : moved)
+        {
+            [[maybe_unused]] auto const inserted = refs->emplace(n, count).second;
+            assert(inserted);
+        }
+
+        for (auto const& v : vlist[x].ntable)
+        {
+            if (refs->contains(v.get()))
+            {
+                dtl_count(v->inner.hi, *refs);
+                dtl_count(v->inner.lo, *refs);
+            }
+        }
+    }
+
+    auto dtl_count(edge_ptr const& f, dtl_refs& refs) const -> void
+    {
+        if (refs[f->v.get()]++ > 0)
+        {  // node already visited
+            return;
+        }
+
+        if (!f->is_const())
+        {
+            dtl_count(f->v->inner.hi, refs);
+            dtl_count(f->v->inner.lo, refs);
+        }
+    }
+
+    auto dtl_move(var_index const lvl_x, var_index const lvl_y, std::optional<dtl_refs>& refs)
+    {  // like sift, whereby only the nodes of the levels in between are recounted
+        if (!refs)
+        {  // #nodes is tracked by exchange anyway
+            sift(lvl_x, lvl_y);
+            return;
+        }
+
+        // The set of reachable nodes outside [first, last] does not change as it only depends on the cofactors with
+        // respect to the variables in between, which are independent of their order.
+        auto const [first, last] = std::minmax(lvl_x, lvl_y);
+
+        std::vector<node const*> reached;
+        for (auto const lvl : std::views::iota(first, last + 1))
+        {
+            for (auto const& v : vlist[lvl2var[lvl]].ntable)
+            {
+                if (refs->contains(v.get()))
+                {
+                    reached.push_back(v.get());
+                }
+            }
+        }
+        for (auto const v : reached)
+        {  // only references from above remain
+            for (auto const* const e : {&v->inner.hi, &v->inner.lo})
+            {
+                auto const it = refs->find((*e)->v.get());
+                assert(it != refs->end());
+
+                if (--it->second == 0)
+                {
+                    refs->erase(it);
+                }
+            }
+        }
+
+        sift(lvl_x, lvl_y);
+
+        for (auto const lvl : std::views::iota(first, last + 1))
+        {  // top-down, so that a node is known to be reachable before its children are visited
+            for (auto const& v : vlist[lvl2var[lvl]].ntable)
+            {
+                if (refs->contains(v.get()))
+                {
+                    ++(*refs)[v->inner.hi->v.get()];
+                    ++(*refs)[v->inner.lo->v.get()];
+                }
+            }
+        }
+    }
+
+    [[nodiscard]] auto dtl_size(std::optional<dtl_refs> const& refs) const noexcept
+    {
+        assert(!refs || refs->size() <= ncount);
+
+        return refs ? refs->size() : ncount;
+    }
+
+    auto dtl_sift_single_var(var_index const x, std::optional<dtl_refs>& refs)
+    {  // the decomposition types are evaluated in alternating directions, changing them where a sweep ends
+        // Trying all types at every level is more expensive, since a change requires XORing the successors of x.
+        auto const bottom = static_cast<var_index>(var_count() - 1);
+        dtl_sift_result res{.x = x, .pos = var2lvl[x], .size = dtl_size(refs), .exp = vlist[x].t};
+        auto update = [this, x, &refs, &res]() {
+            if (auto const curr_size = dtl_size(refs); curr_size < res.size)
+            {
+                res.size = curr_size;
+                res.pos = var2lvl[x];
+                res.exp = vlist[x].t;
+            }
+        };
+        auto sweep = [this, x, bottom, &refs, &update](bool const down) {
+            auto const exceeding_size = static_cast<double>(dtl_size(refs)) * cfg.max_node_growth;
+            for (auto i = var2lvl[x]; (down ? i < bottom : i > 0) && !budget_exhausted(); i = var2lvl[x])
+            {
+                dtl_move(i, down ? i + block(i + 1).second : i - block(i - 1).second, refs);  // skipping groups
+                if (static_cast<double>(dtl_size(refs)) > exceeding_size)
+                {
+                    break;
+                }
+                update();
+            }
+        };
+
+        auto const orig_t = vlist[x].t;
+        auto down = true;
+        sweep(down);
+        for (auto const t : {expansion::S, expansion::pD, expansion::nD})
+        {
+            if (t == orig_t || budget_exhausted())
+            {  // already evaluated or no time left
+                continue;
+            }
+
+            dtl_change(x, t, refs);  // where the previous sweep has ended
+            update();
+            down = !down;
+            sweep(down);
+        }
+
+        // move variable to smallest level with smallest expansion type
+        dtl_move(var2lvl[x], res.pos, refs);
+        dtl_change(x, res.exp, refs);
+        assert(dtl_size(refs) == res.size);
+
+        return res;
+    }
+
+    auto dtl_uncount(edge_ptr const& f, dtl_refs& refs) const -> void
+    {  // counterpart of dtl_count
+        auto const it = refs.find(f->v.get());
+        assert(it != refs.end());
+
+        if (--it->second > 0)
+        {  // node is still reachable
+            return;
+        }
+        refs.erase(it);
+
+        if (!f->is_const())
+        {
+            dtl_uncount(f->v->inner.hi, refs);
+            dtl_uncount(f->v->inner.lo, refs);
+        }
+    }
+
+    [[nodiscard]] auto eval(node_ptr const& v, std::vector<bool> const& as) const -> NValue
+    {
+        if (v->is_const())
+        {
+            return v->outer;
+        }
+
+        NValue res;
+        auto const& br = v->inner;
+        switch (vlist[br.x].t)
+        {
+            case expansion::S:
+            {
+                res = as[br.x] ? eval(br.hi, as) : eval(br.lo, as);
+                break;
+            }
+            case expansion::pD: res = as[br.x] ? merge(eval(br.hi, as), eval(br.lo, as)) : eval(br.lo, as); break;
+            case expansion::nD: res = as[br.x] ? eval(br.lo, as) : merge(eval(br.hi, as), eval(br.lo, as)); break;
+            default: assert(false); std::unreachable();
+        }
+        return res;
+    }
+
+    auto exact()
+    {  // Friedman-Supowit: the #nodes of a level only depends on the set of variables (groups) above
+        auto const grps = blocks();
+        if (grps.size() > 20)
+        {  // state space is exponential
+            group_sift();
+            return;
+        }
+
+        std::vector<var_index> grp2pos(var_count());  // group index => bit position
+        for (auto i = 0uz; i < grps.size(); ++i)
+        {
+            grp2pos[grps[i]] = static_cast<var_index>(i);
+        }
+
+        auto place_on_top = [this, &grp2pos](std::size_t const s) {  // groups in s keep their relative order
+            var_index top = 0;
+            for (var_index lvl = 0; lvl < var_count();)
+            {
+                auto const n = block(lvl).second;
+                if ((s >> grp2pos[var2grp[lvl2var[lvl]]]) & 1)
+                {
+                    move_block(lvl, top, n);
+                    top += n;
+                }
+                lvl += n;
+            }
+            return top;
+        };
+
+        // The #nodes of a single variable directly below the top part equals the number of frontier nodes (referenced
+        // from above) whose support contains it, which is why only groups have to be moved for determining widths.
+        auto frontier_widths = [this, &grp2pos](var_index const top, std::vector<std::size_t>& widths) {
+            boost::unordered_flat_map<node*, std::uint32_t> supps;  // as bit sets of groups
+            boost::unordered_flat_map<edge*, ref_count> inner_refs;  // references from nodes below
+            for (auto lvl = static_cast<var_index>(var_count()); lvl-- > top;)
+            {  // bottom-up
+                for (auto const& v : vlist[lvl2var[lvl]].ntable)
+                {
+                    auto supp = static_cast<std::uint32_t>(1u << grp2pos[var2grp[lvl2var[lvl]]]);
+                    for (auto* const e : {v->inner.hi.get(), v->inner.lo.get()})
+                    {
+                        if (!e->is_const())
+                        {
+                            supp |= supps[e->v.get()];
+                            ++inner_refs[e];
+                        }
+                    }
+                    supps[v.get()] = supp;
+                }
+            }
+
+            std::ranges::fill(widths, 0);
+            boost::unordered_flat_set<node*> frontier;
+            for (auto const lvl : std::views::iota(top, static_cast<var_index>(var_count())))
+            {
+                for (auto const& e : vlist[lvl2var[lvl]].etable)
+                {
+                    if (e->ref - 1 > inner_refs[e.get()] && frontier.insert(e->v.get()).second)
+                    {  // referenced from above (or externally)
+                        for (auto supp = supps[e->v.get()]; supp != 0; supp &= supp - 1)
+                        {
+                            ++widths[std::countr_zero(supp)];
+                        }
+                    }
+                }
+            }
+        };
+
+        auto establish = [this](std::vector<var_index> const& order) {  // top-down
+            var_index top = 0;
+            for (auto const grp : order)
+            {
+                auto const [lvl, n] = block(var2lvl[grp]);
+                move_block(lvl, top, n);
+                top += n;
+            }
+        };
+
+        auto const full = (1uz << grps.size()) - 1;
+        std::vector<std::size_t> cost(full + 1, std::numeric_limits<std::size_t>::max());  // #nodes of the top part
+        std::vector<std::uint8_t> last(full + 1);  // group placed directly below the others
+        cost[0] = 0;
+        auto const bound = ncount - const_count();  // current order is always a solution
+        auto const used = std::ranges::fold_left(  // groups that keep at least one node in any order
+            std::views::iota(0uz, grps.size()), 0uz, [this, &grps](std::size_t const mask, std::size_t const i) {
+                return vlist[grps[i]].ntable.empty() ? mask : mask | (1uz << i);
+            });
+        std::vector<std::size_t> widths(grps.size());
+        for (auto s = 0uz; s < full; ++s)
+        {  // subsets are extended by one group each, so the order of enumeration respects all dependencies
+            if (cost[s] > bound || cost[s] + std::popcount(used & ~s) > bound)
+            {  // cannot lead to an improvement
+                continue;
+            }
+            if (budget_exhausted())
+            {  // keep the initial order
+                establish(grps);
+                return;
+            }
+
+            auto const top = place_on_top(s);
+            frontier_widths(top, widths);
+            for (auto i = 0uz; i < grps.size(); ++i)
+            {
+                if ((s >> i) & 1)
+                {
+                    continue;
+                }
+
+                auto width = widths[i];
+                if (auto const [lvl, n] = block(var2lvl[grps[i]]); n > 1)
+                {  // levels of a group depend on each other
+                    move_block(lvl, top, n);  // directly below the set s
+                    width = std::ranges::fold_left(std::views::iota(top, top + n), 0uz,
+                                                   [this](std::size_t const sum, var_index const j) {
+                                                       return sum + vlist[lvl2var[j]].ntable.size();
+                                                   });
+                }
+
+                if (auto const t = s | (1uz << i); cost[s] + width < cost[t])
+                {
+                    cost[t] = cost[s] + width;
+                    last[t] = static_cast<std::uint8_t>(i);
+                }
+            }
+        }
+
+        // reconstruct the optimal order bottom-up
+        std::vector<var_index> order(grps.size());
+        for (auto s = full, i = grps.size(); s != 0; s &= ~(1uz << last[s]))
+        {
+            order[--i] = grps[last[s]];
+        }
+        establish(order);
+    }
+
+    auto exchange(var_index const lvl)  // NOLINT(readability-function-cognitive-complexity)
+    {
+        if (lvl == var_count() - 1)
+        {  // level below contains only constants
+            return;
+        }
+
+        auto const x = lvl2var[lvl];
+        auto const y = lvl2var[lvl + 1];
+
+        auto collect = [this](var_index const z) {  // level-local garbage collection
+            cleanup(vlist[z].etable);
+            ncount -= cleanup(vlist[z].ntable);
+        };
+
+        if (!ct.empty())
+        {  // results may refer to edges/nodes that are deleted in the following
+            ct.clear();
+        }
+        collect(x);  // ensure that dead nodes are not swapped
+        collect(y);
+
+        auto swap_is_needed = [y](edge_ptr const& hi, edge_ptr const& lo) {
+            auto const hi_has_y = !hi->is_const() && hi->v->inner.x == y;
+            auto const lo_has_y = !lo->is_const() && lo->v->inner.x == y;
+            return hi_has_y || lo_has_y;
+        };
+
+        // look ahead to determine how many swaps need to be performed
+        auto const max_swaps_needed =
+            std::ranges::fold_left(vlist[x].ntable, 0uz, [swap_is_needed](std::size_t const sum, auto const& v) {
+                return swap_is_needed(v->inner.hi, v->inner.lo) ? sum + 2 : sum;  // two branches must be made per swap
             });
         if (vlist[x].ntable.size() + max_swaps_needed > vlist[x].ntable.max_load())
         {  // prevent rehashing during swapping, as it invalidates iterators
@@ -954,6 +2140,7 @@ class manager
             assert(vlist[x].ntable.size() + max_swaps_needed <= vlist[x].ntable.max_load());
         }
 
+        boost::unordered_flat_map<node*, node_ptr> dups;  // duplicated node => original node
         for (auto node_it = vlist[x].ntable.begin(); node_it != vlist[x].ntable.end();)
         {
             if (swap_is_needed((*node_it)->inner.hi, (*node_it)->inner.lo))  // level swap is a local transformation
@@ -965,29 +2152,11 @@ class manager
                 auto hi = branch(x, cof(br.hi, y, true), cof(br.lo, y, true));
                 br.lo = branch(x, cof(br.hi, y, false), cof(br.lo, y, false));
                 br.hi = std::move(hi);
-                br.x = y;
+                br.x = y;  // node is rewritten in place so that incoming edges remain valid
 
-                if (!vlist[y].ntable.insert(v).second)
+                if (auto const [it, inserted] = vlist[y].ntable.insert(v); !inserted)
                 {  // insertion failed (edge case) => same node already exists
-                    auto const& orig_v = *vlist[y].ntable.find(v);
-                    boost::unordered_flat_set<edge_ptr, hash, equal> tmp;
-                    for (auto edge_it = vlist[x].etable.begin(); edge_it != vlist[x].etable.end();)
-                    {
-                        if ((*edge_it)->v == v)
-                        {  // redirect incoming edge of duplicated node to original node
-                            auto e = *edge_it;
-                            edge_it = vlist[x].etable.erase(edge_it);
-
-                            e->v = orig_v;
-
-                            tmp.insert(e);
-                        }
-                        else
-                        {
-                            ++edge_it;
-                        }
-                    }
-                    vlist[x].etable.merge(tmp);
+                    dups.emplace(v.get(), *it);
                 }
             }
             else
@@ -997,22 +2166,33 @@ class manager
         }
 
         for (auto it = vlist[x].etable.begin(); it != vlist[x].etable.end();)
-        {  // reassign edges pointing to swapped nodes
+        {  // reassign edges pointing to swapped nodes in a single pass
             if ((*it)->v->inner.x == y)
             {
-                vlist[y].etable.insert(*it);
+                auto e = *it;
                 it = vlist[x].etable.erase(it);
+
+                if (auto const dup = dups.find(e->v.get()); dup != dups.end())
+                {  // redirect incoming edge of duplicated node to original node
+                    e->v = dup->second;
+                }
+
+                [[maybe_unused]] auto const inserted = vlist[y].etable.insert(std::move(e)).second;
+                assert(inserted);
             }
             else
             {
                 ++it;
             }
         }
+        ncount -= dups.size();  // duplicates are released when the last reference is lost
 
         std::swap(lvl2var[lvl], lvl2var[lvl + 1]);
         std::swap(var2lvl[x], var2lvl[y]);
+        ++swap_count;
 
-        gc();  // clean up possible dead nodes
+        collect(y);  // clean up possible dead nodes, whereby only both levels are affected
+        collect(x);
     }
 
     template <class T>
@@ -1025,11 +2205,64 @@ class manager
             {  // try GC to avoid expensive rehashing
                 gc();
             }
+            if constexpr (std::is_same_v<T, node>)
+            {
+                if (++ncount > std::max(reorder_thresh(), next_check) && cfg.dyn_reorder != reorder_method::NONE)
+                {  // postpone reordering until the next safe point is reached
+                    reorder_due = true;
+                }
+            }
             return *ut.insert(boost::intrusive_ptr<T>{new T{std::forward<T>(obj)}}).first;
         }
         return *search;
     }
 
+    auto group_sift(bool const converge = false)
+    {
+        for (auto prev_ncount = ncount;; prev_ncount = ncount)
+        {
+            // variables with the most nodes are sifted first, as they offer the greatest potential for reduction
+            std::vector<var_index> xs(var_count());
+            std::ranges::copy(std::views::iota(0u, var_count()), xs.begin());
+            std::ranges::stable_sort(xs, [this](var_index const x, var_index const y) {
+                return vlist[x].ntable.size() > vlist[y].ntable.size();
+            });
+
+            std::vector<bool> sifted(var_count());  // per group
+            for (auto const x : xs)
+            {
+                if (budget_exhausted())
+                {
+                    break;
+                }
+                if (sifted[var2grp[x]])
+                {  // group has already been moved as a unit
+                    continue;
+                }
+                sifted[var2grp[x]] = true;
+
+                auto const [lvl, n] = block(var2lvl[x]);
+                std::pair<var_index, std::size_t> min{lvl, ncount};  // (level, nodes)
+                var_index stop_lvl{};
+                if (var_count() - n - lvl < lvl)
+                {  // the closer end is visited first
+                    stop_lvl = sift_up(sift_down(lvl, n, min), n, min);  // taking into account max_node_growth
+                }
+                else
+                {
+                    stop_lvl = sift_down(sift_up(lvl, n, min), n, min);
+                }
+                move_block(stop_lvl, min.first, n);  // move the group to the position of the local minimum
+            }
+
+            if (!converge || budget_exhausted() ||
+                static_cast<float>(prev_ncount - ncount) < cfg.min_reorder_gain * static_cast<float>(prev_ncount))
+            {  // sifting never increases the size, so another pass is only worthwhile for sufficient gains
+                break;
+            }
+        }
+    }
+
     [[nodiscard]] auto heap_usage() const noexcept  // estimation
     {
         auto bytes = 0uz;
@@ -1061,6 +2294,271 @@ class manager
         return bytes;
     }
 
+    auto move_block(var_index const lvl_x, var_index const lvl_y, var_index const n)
+    {  // moves n variables starting at lvl_x to lvl_y while preserving their order
+        if (lvl_x < lvl_y)
+        {
+            for (auto const i : std::views::iota(0u, n) | std::views::reverse)
+            {
+                sift(lvl_x + i, lvl_y + i);
+            }
+        }
+        else
+        {
+            for (auto const i : std::views::iota(0u, n))
+            {
+                sift(lvl_x + i, lvl_y + i);
+            }
+        }
+    }
+
+    auto normalize_parents(var_index const lvl, boost::unordered_flat_set<edge const*> flipped,
+                           boost::unordered_flat_map<node const*, node const*>& repl)
+    {  // incoming edges of the nodes at lvl have been inverted, which may cascade upwards
+        for (auto const z : lvl2var | std::views::take(lvl) | std::views::reverse)
+        {
+            std::vector<node_ptr> vs;  // as normalization may create nodes
+            for (auto const& v : vlist[z].ntable)
+            {
+                if (flipped.contains(v->inner.hi.get()) || flipped.contains(v->inner.lo.get()))
+                {
+                    vs.push_back(v);
+                }
+            }
+
+            boost::unordered_flat_map<node*, edge_ptr> normed;  // node => normalized edge representing it
+            for (auto const& v : vs)
+            {
+                auto e = branch(z, edge_ptr{v->inner.hi}, edge_ptr{v->inner.lo});
+                if (e->v != v)
+                {
+                    normed.emplace(v.get(), std::move(e));
+                }
+            }
+            if (normed.empty())
+            {  // edges may skip levels, so that inversions can still propagate
+                continue;
+            }
+
+            std::vector<edge_ptr> tmp;  // incoming edges are redirected in two phases to avoid collisions
+            for (auto it = vlist[z].etable.begin(); it != vlist[z].etable.end();)
+            {
+                if (auto const n = normed.find((*it)->v.get()); n != normed.end())
+                {
+                    auto e = *it;
+                    it = vlist[z].etable.erase(it);
+
+                    e->w = comb(e->w, n->second->w);
+                    e->v = n->second->v;
+                    tmp.push_back(std::move(e));
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            for (auto const& [v, e] : normed)
+            {  // replaced nodes are no longer referenced
+                repl.emplace(v, e->v.get());
+                vlist[z].ntable.erase(node_ptr{v});
+            }
+            ncount -= normed.size();
+            normed.clear();  // edges created by normalization are dead unless they were already in use
+
+            for (auto const& e : tmp)
+            {
+                if (auto const [it, inserted] = vlist[z].etable.insert(e); !inserted)
+                {  // replace the edge created by normalization
+                    assert((*it)->is_dead());
+
+                    vlist[z].etable.erase(it);
+                    vlist[z].etable.insert(e);
+                }
+                flipped.insert(e.get());
+            }
+        }
+    }
+
+    static auto plain_changes(var_index const k) -> std::vector<var_index>
+    {  // adjacent transpositions (by left position) that enumerate all k! permutations (Steinhaus-Johnson-Trotter)
+        if (k <= 1)
+        {
+            return {};
+        }
+
+        auto const sub = plain_changes(k - 1);
+        std::vector<var_index> swaps;
+        for (auto i = 0uz; i <= sub.size(); ++i)
+        {  // the last element sweeps across the permutations of the others
+            for (var_index j = 0; j < k - 1; ++j)
+            {
+                swaps.push_back(i % 2 == 0 ? k - 2 - j : j);
+            }
+            if (i < sub.size())
+            {
+                swaps.push_back(sub[i] + (i % 2 == 0 ? 1 : 0));
+            }
+        }
+        return swaps;
+    }
+
+    auto reordered() noexcept
+    {
+        reorder_due = false;
+        next_check = 0;
+        next_thresh = static_cast<std::size_t>(static_cast<float>(node_count()) * cfg.reorder_growth);
+    }
+
+    [[nodiscard]] auto reorder_thresh() const noexcept
+    {
+        return std::max(cfg.reorder_thresh, next_thresh);
+    }
+
+    auto rewrite_level(var_index const x, expansion const t)
+    {  // changes the decomposition type of x by local transformations and returns which node replaced which one
+        assert(vlist[x].t != t);
+
+        // With the cofactors f0/f1 of a node and their difference df = f0 XOR f1, it holds that S: (hi, lo) = (f1, f0),
+        // pD: (hi, lo) = (df, f0), and nD: (hi, lo) = (df, f1). Two of them determine the third one.
+        auto const orig_t = vlist[x].t;
+        std::vector<node_ptr> vs(vlist[x].ntable.begin(), vlist[x].ntable.end());
+        vlist[x].ntable.clear();  // as rewritten nodes must not collide with the ones to be replaced
+        ncount -= vs.size();
+        std::vector<edge_ptr> tmp(vlist[x].etable.begin(), vlist[x].etable.end());  // incoming edges
+        vlist[x].etable.clear();
+        vlist[x].t = t;
+
+        auto derive = [this](edge_ptr const& g, edge_ptr const& h1, edge_ptr const& h2) {
+            return g ? g : plus(h1, h2);  // corresponds to XOR for bit-level DDs
+        };
+        boost::unordered_flat_map<node const*, edge_ptr> normed;  // node => rewritten edge representing it
+        for (auto const& v : vs)
+        {
+            edge_ptr f0;
+            edge_ptr f1;
+            edge_ptr df;
+            switch (orig_t)
+            {
+                case expansion::S:
+                    f1 = v->inner.hi;
+                    f0 = v->inner.lo;
+                    break;
+                case expansion::pD:
+                    df = v->inner.hi;
+                    f0 = v->inner.lo;
+                    break;
+                case expansion::nD:
+                    df = v->inner.hi;
+                    f1 = v->inner.lo;
+                    break;
+                default: assert(false); std::unreachable();
+            }
+
+            edge_ptr e;
+            switch (t)
+            {
+                case expansion::S: e = branch(x, derive(f1, f0, df), derive(f0, f1, df)); break;
+                case expansion::pD: e = branch(x, derive(df, f0, f1), derive(f0, f1, df)); break;
+                case expansion::nD: e = branch(x, derive(df, f0, f1), derive(f1, f0, df)); break;
+                default: assert(false); std::unreachable();
+            }
+            assert(!e->is_const() && e->v->inner.x == x);  // no node becomes redundant as it depends on x
+
+            normed.emplace(v.get(), std::move(e));
+        }
+
+        // incoming edges are redirected in two phases to avoid collisions
+        boost::unordered_flat_set<edge const*> flipped;
+        boost::unordered_flat_map<node const*, node const*> repl;
+        for (auto const& e : tmp)
+        {
+            auto const& n = normed.at(e->v.get());
+            if (n->w != regw())
+            {  // parents may now violate normalization rules
+                flipped.insert(e.get());
+            }
+            repl.emplace(e->v.get(), n->v.get());
+
+            e->w = comb(e->w, n->w);
+            e->v = n->v;
+        }
+        normed.clear();  // edges created by rewriting are dead unless they were already in use
+        for (auto const& e : tmp)
+        {
+            if (auto const [it, inserted] = vlist[x].etable.insert(e); !inserted)
+            {  // replace the edge created by rewriting
+                assert((*it)->is_dead());
+
+                vlist[x].etable.erase(it);
+                vlist[x].etable.insert(e);
+            }
+        }
+        tmp.clear();
+
+        if (!flipped.empty())
+        {
+            normalize_parents(var2lvl[x], std::move(flipped), repl);
+        }
+        ct.clear();  // as results may refer to nodes whose meaning has changed
+
+        // Successors of replaced nodes may have become dead, which is checked level by level (top-down).
+        std::vector<std::vector<edge*>> succs(var_count());
+        auto add_succs = [this, &succs](node const& v) {
+            for (auto const* const e : {&v.inner.hi, &v.inner.lo})
+            {
+                if (!(*e)->is_const())
+                {
+                    succs[var2lvl[(*e)->v->inner.x]].push_back(e->get());
+                }
+            }
+        };
+        for (auto const& v : vs)
+        {
+            add_succs(*v);
+        }
+        vs.clear();  // replaced nodes are released
+        for (auto const lvl : std::views::iota(var2lvl[x] + 1, var_count()))
+        {
+            auto const y = lvl2var[lvl];
+            auto& es = succs[lvl];
+            std::ranges::sort(es);
+            es.erase(std::ranges::unique(es).begin(), es.end());
+
+            std::vector<std::pair<node*, EWeight>> ws;  // nodes that have lost an incoming edge => inverted weight
+            for (auto* const e : es)
+            {
+                if (e->is_dead())
+                {
+                    ws.emplace_back(e->v.get(), !e->w);
+                    vlist[y].etable.erase(vlist[y].etable.find(e));
+                }
+            }
+            std::ranges::sort(ws, {}, &std::pair<node*, EWeight>::first);
+            ws.erase(std::ranges::unique(ws, {}, &std::pair<node*, EWeight>::first).begin(), ws.end());
+
+            for (auto& [w, inv] : ws)
+            {
+                {  // the edge with inverted weight may be a leftover of complementing
+                    edge sibling{std::move(inv), node_ptr{w}};
+                    if (auto const it = vlist[y].etable.find(&sibling);
+                        it != vlist[y].etable.end() && (*it)->is_dead())
+                    {
+                        vlist[y].etable.erase(it);
+                    }
+                }
+                if (w->is_dead())
+                {
+                    add_succs(*w);
+                    vlist[y].ntable.erase(vlist[y].ntable.find(w));
+                    --ncount;
+                }
+            }
+        }
+        assert(ncount == node_count());
+
+        return repl;
+    }
+
     auto sift(var_index const lvl_x, var_index const lvl_y)
     {
         if (lvl_x == lvl_y)
@@ -1084,16 +2582,41 @@ class manager
         }
     }
 
-    auto sift_down(var_index lvl, std::pair<var_index, std::size_t>& min)
-    {
+    auto sift_down(var_index lvl, var_index const n, std::pair<var_index, std::size_t>& min)
+    {  // moves the group of n variables starting at lvl downwards
+        // Levels above are no longer affected and every remaining variable keeps at least one node (lower bound).
+        auto above = const_count();
+        for (auto const i : std::views::iota(0u, lvl))
+        {
+            above += vlist[lvl2var[i]].ntable.size();
+        }
+        auto remaining = static_cast<std::size_t>(
+            std::ranges::count_if(std::views::iota(lvl, var_count()),
+                                  [this](var_index const i) { return !vlist[lvl2var[i]].ntable.empty(); }));
+
         auto prev_ncount = 0uz;
         auto curr_ncount = 0uz;
-        while (lvl + 1 < var_count() && static_cast<decltype(cfg.max_node_growth)>(prev_ncount) * cfg.max_node_growth >=
+        while (lvl + n < var_count() && static_cast<decltype(cfg.max_node_growth)>(prev_ncount) * cfg.max_node_growth >=
                                             static_cast<decltype(cfg.max_node_growth)>(curr_ncount))
         {
-            prev_ncount = node_count();
-            exchange(lvl++);
-            curr_ncount = node_count();
+            if (above + remaining >= min.second || budget_exhausted())
+            {  // no improvement possible anymore
+                break;
+            }
+
+            auto const m = block(lvl + n).second;  // size of the group below
+
+            prev_ncount = ncount;
+            move_block(lvl, lvl + m, n);
+            curr_ncount = ncount;  // tracked incrementally
+
+            for (auto const i : std::views::iota(lvl, lvl + m))
+            {
+                auto const& y_ntable = vlist[lvl2var[i]].ntable;
+                above += y_ntable.size();
+                remaining -= y_ntable.empty() ? 0 : 1;
+            }
+            lvl += m;
 
             if (curr_ncount < min.second)
             {
@@ -1101,21 +2624,45 @@ class manager
             }
         }
 
+        assert(ncount == node_count());  // once per call, as counting all levels would undo the incremental tracking
+
         return lvl;
     }
 
-    auto sift_up(var_index lvl, std::pair<var_index, std::size_t>& min)
-    {
+    auto sift_up(var_index lvl, var_index const n, std::pair<var_index, std::size_t>& min)
+    {  // moves the group of n variables starting at lvl upwards
+        // Levels below are no longer affected and every remaining variable keeps at least one node (lower bound).
+        auto below = const_count();
+        for (auto const i : std::views::iota(lvl + n, var_count()))
+        {
+            below += vlist[lvl2var[i]].ntable.size();
+        }
+        auto remaining = static_cast<std::size_t>(std::ranges::count_if(
+            std::views::iota(0u, lvl + n), [this](var_index const i) { return !vlist[lvl2var[i]].ntable.empty(); }));
+
         auto prev_ncount = 0uz;
         auto curr_ncount = 0uz;
         while (lvl > 0 && static_cast<decltype(cfg.max_node_growth)>(prev_ncount) * cfg.max_node_growth >=
                               static_cast<decltype(cfg.max_node_growth)>(curr_ncount))
         {
-            --lvl;
+            if (below + remaining >= min.second || budget_exhausted())
+            {  // no improvement possible anymore
+                break;
+            }
 
-            prev_ncount = node_count();
-            exchange(lvl);
-            curr_ncount = node_count();
+            auto const m = block(lvl - 1).second;  // size of the group above
+
+            prev_ncount = ncount;
+            move_block(lvl, lvl - m, n);
+            curr_ncount = ncount;  // tracked incrementally
+
+            lvl -= m;
+            for (auto const i : std::views::iota(lvl + n, lvl + n + m))
+            {
+                auto const& y_ntable = vlist[lvl2var[i]].ntable;
+                below += y_ntable.size();
+                remaining -= y_ntable.empty() ? 0 : 1;
+            }
 
             if (curr_ncount < min.second)
             {
@@ -1123,6 +2670,8 @@ class manager
             }
         }
 
+        assert(ncount == node_count());  // once per call, as counting all levels would undo the incremental tracking
+
         return lvl;
     }
 
@@ -1140,18 +2689,188 @@ class manager
         }
     }
 
+    auto support(edge_ptr const& f, boost::unordered_flat_set<node*, hash, equal>& marks, std::vector<bool>& xs) const
+    {
+        if (f->is_const() || !marks.insert(f->v.get()).second)
+        {
+            return;
+        }
+
+        xs[f->v->inner.x] = true;
+        support(f->v->inner.hi, marks, xs);
+        support(f->v->inner.lo, marks, xs);
+    }
+
+    auto start_reordering() noexcept
+    {  // budgets refer to a single reordering
+        reorder_start = std::chrono::steady_clock::now();
+        swap_count = 0;
+    }
+
+    auto symm_sift()
+    {  // symmetric variables are temporarily grouped so that they are moved together
+        auto const user_grps = var2grp;
+        std::vector<var_index> grp_sizes(var_count());
+        for (auto const grp : user_grps)
+        {
+            ++grp_sizes[grp];
+        }
+
+        auto detect = [this, &user_grps, &grp_sizes]() {  // whether new symmetries have been found
+            auto found = false;
+            for (var_index lvl = 0; lvl + 1 < var_count(); ++lvl)
+            {
+                auto const x = lvl2var[lvl];
+                auto const y = lvl2var[lvl + 1];
+                if (grp_sizes[user_grps[x]] == 1 && grp_sizes[user_grps[y]] == 1 && var2grp[x] != var2grp[y] &&
+                    symmetric(lvl))
+                {  // symmetry is transitive, so y and the variables grouped with it join the group of x
+                    auto const [first, n] = block(lvl + 1);
+                    for (auto const i : std::views::iota(first, first + n))
+                    {
+                        var2grp[lvl2var[i]] = var2grp[x];
+                    }
+                    found = true;
+                }
+            }
+            return found;
+        };
+
+        detect();
+        group_sift();
+        while (!budget_exhausted() && detect())
+        {  // sifting has made other variables adjacent
+            group_sift();
+        }
+
+        var2grp = user_grps;  // user-defined groups have been kept as they were moved as units
+    }
+
+    [[nodiscard]] auto symmetric(var_index const lvl) -> bool
+    {  // whether the variables at lvl and lvl + 1 are symmetric in all DDs (apart from their projection functions)
+        assert(lvl + 1 < var_count());
+
+        auto const x = lvl2var[lvl];
+        auto const y = lvl2var[lvl + 1];
+        if (vlist[x].t != vlist[y].t)
+        {  // their cofactors (moments) cannot be compared
+            return false;
+        }
+
+        boost::unordered_flat_map<edge*, ref_count> x_refs;  // references from x to y
+        for (auto const& v : vlist[x].ntable)
+        {
+            if (v == vars[x]->v)
+            {
+                continue;
+            }
+            for (auto const& e : {v->inner.hi, v->inner.lo})
+            {
+                if (!e->is_const() && e->v->inner.x == y)
+                {
+                    ++x_refs[e.get()];
+                }
+            }
+            if (cof(v->inner.hi, y, false) != cof(v->inner.lo, y, true))
+            {  // f_10 != f_01
+                return false;
+            }
+        }
+        for (auto const& e : vlist[y].etable)
+        {
+            if (e->v != vars[y]->v && e->ref - 1 > x_refs[e.get()])
+            {  // y is reachable without x being tested
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto window(var_index const k)
+    {  // sliding window over adjacent groups
+        auto const swaps = plain_changes(k);
+
+        auto swap_blocks = [this](var_index const lvl, std::vector<var_index>& perm, var_index const j) {
+            auto first = lvl;  // of the j-th group in the window
+            for (auto i = 0u; i < j; ++i)
+            {
+                first += block(var2lvl[perm[i]]).second;
+            }
+            auto const n = block(first).second;
+            move_block(first, first + block(first + n).second, n);
+            std::swap(perm[j], perm[j + 1]);
+        };
+
+        for (auto improved = true; improved && !budget_exhausted();)
+        {
+            auto const prev_ncount = ncount;
+            for (var_index lvl = 0; lvl < var_count() && !budget_exhausted(); lvl += block(lvl).second)
+            {
+                std::vector<var_index> perm;  // groups in the window
+                for (auto i = lvl; i < var_count() && perm.size() < k; i += block(i).second)
+                {
+                    perm.push_back(var2grp[lvl2var[i]]);
+                }
+                if (perm.size() < k)
+                {  // end is reached
+                    break;
+                }
+
+                auto best = perm;
+                auto min = ncount;
+                for (auto const j : swaps)
+                {
+                    swap_blocks(lvl, perm, j);
+                    if (ncount < min)
+                    {
+                        best = perm;
+                        min = ncount;
+                    }
+                }
+
+                for (var_index j = 0; j < k; ++j)
+                {  // restore the best permutation
+                    for (auto i = static_cast<var_index>(std::ranges::find(perm, best[j]) - perm.begin()); i > j; --i)
+                    {
+                        swap_blocks(lvl, perm, i - 1);
+                    }
+                }
+                assert(ncount == min);
+            }
+            improved = ncount < prev_ncount;
+        }
+    }
+
     struct config cfg;  // configuration settings such as hash table sizes
 
     std::vector<edge_ptr> consts;  // DD constants that are never cleared
 
     computed_table ct;  // to cache already computed results of operations
 
+    std::size_t dyn_reorders{};  // number of reorderings triggered at safe points
+
     unique_table<edge> etable;  // edges pointing to constants
 
+    std::size_t gc_runs{};  // number of garbage collections
+
     std::vector<var_index> lvl2var;  // for efficient GC
 
+    std::size_t ncount{};  // number of nodes including dead ones since the last GC
+
+    std::size_t next_check{};  // #nodes (including dead ones) from which node growth is checked again
+
+    std::size_t next_thresh{};  // #nodes after the last reordering multiplied by the growth factor
+
     unique_table<node> ntable;  // constants
 
+    bool reorder_due{};  // whether dynamic reordering should take place at the next safe point
+
+    std::chrono::steady_clock::time_point reorder_start;  // of the current reordering for its time budget
+
+    std::size_t swap_count{};  // level exchanges of the current reordering for its swap budget
+
+    std::vector<var_index> var2grp;  // variables of a group share an index and occupy contiguous levels
+
     std::vector<var_index> var2lvl;  // for reasons of reordering
 
     std::vector<edge_ptr> vars;  // DD variables that are never cleared
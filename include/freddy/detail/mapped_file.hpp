@@ -0,0 +1,141 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#if defined(__APPLE__) || defined(__linux__)
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close
+#elifdef _WIN32
+#define WIN32_LEAN_AND_MEAN  // exclude unused APIs such as cryptography
+#define NOMINMAX             // preventing conflicts with std::max
+#include <windows.h>         // MapViewOfFile
+#endif
+
+#include <cerrno>        // errno
+#include <cstddef>       // std::size_t
+#include <filesystem>    // std::filesystem::path
+#include <system_error>  // std::system_error
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy::detail
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+class mapped_file final  // read-only mapping of a whole file, which is shared between processes via the page cache
+{
+  public:
+    explicit mapped_file(std::filesystem::path const& path)
+    {
+#if defined(__APPLE__) || defined(__linux__)
+        auto const fd = ::open(path.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+        if (fd == -1)
+        {
+            throw std::system_error{errno, std::generic_category(), path.string()};
+        }
+        auto fail = [fd, &path]() {
+            auto const err = errno;
+            ::close(fd);
+            throw std::system_error{err, std::generic_category(), path.string()};
+        };
+
+        struct stat st{};
+        if (::fstat(fd, &st) == -1)
+        {
+            fail();
+        }
+        len = static_cast<std::size_t>(st.st_size);
+        if (len > 0)
+        {  // mapping empty files is not allowed
+            addr = ::mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED)  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+            {
+                addr = nullptr;
+                fail();
+            }
+        }
+        ::close(fd);  // the mapping remains valid
+#elifdef _WIN32
+        auto* const file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                         FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            throw std::system_error{static_cast<int>(::GetLastError()), std::system_category(), path.string()};
+        }
+        auto fail = [file, &path]() {
+            auto const err = ::GetLastError();
+            ::CloseHandle(file);
+            throw std::system_error{static_cast<int>(err), std::system_category(), path.string()};
+        };
+
+        LARGE_INTEGER size{};
+        if (!::GetFileSizeEx(file, &size))
+        {
+            fail();
+        }
+        len = static_cast<std::size_t>(size.QuadPart);
+        if (len > 0)
+        {  // mapping empty files is not allowed
+            auto* const mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping)
+            {
+                fail();
+            }
+            addr = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping);  // the view keeps the mapping alive
+            if (!addr)
+            {
+                fail();
+            }
+        }
+        ::CloseHandle(file);
+#endif
+    }
+
+    mapped_file(mapped_file const&) = delete;
+
+    mapped_file(mapped_file&&) = delete;
+
+    auto operator=(mapped_file const&) = delete;
+
+    auto operator=(mapped_file&&) = delete;
+
+    ~mapped_file()
+    {
+        if (!addr)
+        {
+            return;
+        }
+#if defined(__APPLE__) || defined(__linux__)
+        ::munmap(addr, len);
+#elifdef _WIN32
+        ::UnmapViewOfFile(addr);
+#endif
+    }
+
+    [[nodiscard]] auto data() const noexcept
+    {
+        return static_cast<char const*>(addr);
+    }
+
+    [[nodiscard]] auto size() const noexcept
+    {
+        return len;
+    }
+
+  private:
+    void* addr{};
+
+    std::size_t len{};
+};
+
+}  // namespace freddy::detail
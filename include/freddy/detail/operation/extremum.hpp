@@ -0,0 +1,73 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/detail/common.hpp"     // hashable
+#include "freddy/detail/edge.hpp"       // edge
+#include "freddy/detail/node.hpp"       // edge_ptr
+#include "freddy/detail/operation.hpp"  // operation
+
+#include <cassert>     // assert
+#include <functional>  // std::hash
+#include <optional>    // std::optional
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy::detail
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+template <hashable EWeight, hashable NValue>
+class extremum final : public operation  // minimum/maximum of the terminal values
+{
+  public:
+    // for looking up a cached result using extremum input
+    extremum(edge_ptr<EWeight, NValue> const& f, bool const max) :
+            f{f.get()},
+            max{max}
+    {
+        assert(this->f);
+    }
+
+    [[nodiscard]] auto get_result() const noexcept
+    {
+        assert(result);
+
+        return *result;
+    }
+
+    auto set_result(NValue const& res)
+    {
+        assert(!result);  // ensure a valid extremum is only set once
+
+        result = res;
+    }
+
+  private:
+    [[nodiscard]] auto hash() const noexcept -> std::size_t override
+    {
+        return std::hash<edge<EWeight, NValue>*>{}(f) + static_cast<std::size_t>(max);
+    }
+
+    [[nodiscard]] auto equals(operation const& op) const noexcept -> bool override
+    {
+        auto& other = static_cast<extremum const&>(op);
+
+        return f == other.f && max == other.max;
+    }
+
+    edge<EWeight, NValue>* f;  // extremum operand
+
+    bool max;  // otherwise minimum
+
+    std::optional<NValue> result;
+};
+
+}  // namespace freddy::detail
@@ -0,0 +1,107 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"            // var_index
+#include "freddy/detail/common.hpp"     // P1
+#include "freddy/detail/edge.hpp"       // edge
+#include "freddy/detail/node.hpp"       // edge_ptr
+#include "freddy/detail/operation.hpp"  // operation
+
+#include <cassert>     // assert
+#include <functional>  // std::hash
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::shared_ptr
+#include <tuple>       // std::tie
+#include <utility>     // std::pair
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy::detail
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+struct cover_node;
+
+using cover_ptr = std::shared_ptr<cover_node const>;  // nullptr is the empty cover
+
+// Cube set that is shared like a ZDD: It consists of the cubes of neg extended by ~x, the cubes of pos extended by x,
+// and the cubes of dc, whereby x precedes the variables of all subcovers.
+struct cover_node final
+{
+    static constexpr auto taut_var = std::numeric_limits<var_index>::max();
+
+    static auto taut()  // cover consisting of the empty cube
+    {
+        static cover_ptr const c = std::make_shared<cover_node const>(taut_var, nullptr, nullptr, nullptr);
+        return c;
+    }
+
+    var_index x;
+
+    cover_ptr neg, pos, dc;
+};
+
+template <hashable EWeight, hashable NValue>
+class isop final : public operation  // irredundant sum of products
+{
+  public:
+    using edge = detail::edge<EWeight, NValue>;
+
+    using edge_ptr = detail::edge_ptr<EWeight, NValue>;
+
+    // for looking up a cached result using ISOP input
+    isop(edge_ptr const& l, edge_ptr const& u) :
+            l{l.get()},
+            u{u.get()}
+    {
+        assert(this->l);
+        assert(this->u);
+    }
+
+    [[nodiscard]] auto get_result() const -> std::pair<edge_ptr, cover_ptr>
+    {
+        assert(result);
+
+        return {result, cover};
+    }
+
+    auto set_result(edge_ptr const& res, cover_ptr c) noexcept
+    {
+        assert(res);
+        assert(!result);  // ensure a valid ISOP result is only set once
+
+        result = res.get();
+        cover = std::move(c);
+    }
+
+  private:
+    [[nodiscard]] auto hash() const noexcept -> std::size_t override
+    {
+        return std::hash<edge*>{}(l)*P1 + std::hash<edge*>{}(u)*P2;
+    }
+
+    [[nodiscard]] auto equals(operation const& op) const noexcept -> bool override
+    {
+        auto& other = static_cast<isop const&>(op);
+
+        return std::tie(l, u) == std::tie(other.l, other.u);
+    }
+
+    edge* l;  // lower bound
+
+    edge* u;  // upper bound
+
+    edge* result{};  // function of the cover, which lies between both bounds
+
+    cover_ptr cover;
+};
+
+}  // namespace freddy::detail
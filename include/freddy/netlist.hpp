@@ -0,0 +1,707 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"         // reorder_method
+#include "freddy/detail/common.hpp"  // detail::parallel_for
+
+#include <boost/unordered/unordered_flat_map.hpp>  // boost::unordered_flat_map
+
+#include <algorithm>     // std::ranges::max
+#include <cassert>       // assert
+#include <charconv>      // std::from_chars
+#include <cstddef>       // std::size_t
+#include <cstdint>       // std::uint8_t
+#include <exception>     // std::exception_ptr
+#include <filesystem>    // std::filesystem::path
+#include <fstream>       // std::ifstream
+#include <istream>       // std::istream
+#include <optional>      // std::optional
+#include <sstream>       // std::istringstream
+#include <stdexcept>     // std::runtime_error
+#include <string>        // std::string
+#include <string_view>   // std::string_view
+#include <system_error>  // std::errc
+#include <utility>       // std::pair
+#include <vector>        // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+struct cover final  // function of a gate as a sum of products (single-output cover as in BLIF)
+{
+    std::vector<std::string> cubes;  // one character per fan-in: '1', '0', or '-' (don't care)
+
+    bool onset{true};  // Do the cubes describe the on-set or the off-set? No cubes means constant 0.
+};
+
+struct netlist final  // structure of a combinational circuit (sequential elements are cut)
+{
+    std::size_t inputs{};  // primary inputs are the signals 0, ..., inputs - 1
+
+    std::vector<std::vector<std::size_t>> gates;  // fan-ins of gate i driving signal inputs + i (topologically sorted)
+
+    std::vector<std::size_t> outputs;  // signals driving primary outputs
+
+    std::vector<cover> covers;  // functions of the gates if known, e.g., when read from a file
+
+    std::vector<std::string> input_names;  // if known
+
+    std::vector<std::string> output_names;  // if known
+
+    [[nodiscard]] auto signal_count() const noexcept
+    {
+        return inputs + gates.size();
+    }
+};
+
+namespace detail
+{
+
+struct netlist_builder final  // signals are identified by IDs that are mapped to a topological order when building
+{
+    std::vector<std::size_t> inputs;
+
+    std::vector<std::optional<std::pair<std::vector<std::size_t>, cover>>> defs;  // per ID
+
+    std::vector<std::size_t> outputs;
+
+    auto define(std::size_t const id, std::vector<std::size_t> fanins, cover c)
+    {
+        if (id >= defs.size())
+        {
+            defs.resize(id + 1);
+        }
+        if (defs[id])
+        {
+            throw std::runtime_error{"Signal is defined more than once."};
+        }
+        defs[id].emplace(std::move(fanins), std::move(c));
+    }
+
+    [[nodiscard]] auto build() const
+    {
+        netlist nl;
+        nl.inputs = inputs.size();
+
+        std::vector<std::optional<std::size_t>> sig(defs.size());  // signal per ID
+        for (auto i = 0uz; i < inputs.size(); ++i)
+        {
+            if (inputs[i] >= sig.size())
+            {
+                sig.resize(inputs[i] + 1);
+            }
+            if (sig[inputs[i]] || (inputs[i] < defs.size() && defs[inputs[i]]))
+            {
+                throw std::runtime_error{"Primary input is defined more than once."};
+            }
+            sig[inputs[i]] = i;
+        }
+
+        enum struct state : std::uint8_t
+        {
+            NEW,
+            OPEN,
+            DONE
+        };
+        std::vector<state> states(defs.size(), state::NEW);
+        auto emit = [&](std::size_t const id) {
+            std::vector<std::pair<std::size_t, std::size_t>> stack{{id, 0}};  // (ID, next fan-in)
+            states[id] = state::OPEN;
+            while (!stack.empty())
+            {  // iteratively, as circuits can be deep
+                auto& [v, k] = stack.back();
+                auto const& [fanins, c] = *defs[v];
+                if (k < fanins.size())
+                {
+                    auto const u = fanins[k++];
+                    if (u < sig.size() && sig[u])
+                    {  // primary input or gate that has already been emitted
+                        continue;
+                    }
+                    if (u >= defs.size() || !defs[u])
+                    {
+                        throw std::runtime_error{"Signal is used but not defined."};
+                    }
+                    if (states[u] == state::OPEN)
+                    {
+                        throw std::runtime_error{"Netlist contains a combinational cycle."};
+                    }
+                    if (states[u] == state::NEW)
+                    {
+                        states[u] = state::OPEN;
+                        stack.emplace_back(u, 0);
+                    }
+                    continue;
+                }
+
+                std::vector<std::size_t> gate(fanins.size());
+                for (auto i = 0uz; i < fanins.size(); ++i)
+                {
+                    gate[i] = *sig[fanins[i]];
+                }
+                sig[v] = nl.signal_count();
+                nl.gates.push_back(std::move(gate));
+                nl.covers.push_back(c);
+                states[v] = state::DONE;
+                stack.pop_back();
+            }
+        };
+        for (auto id = 0uz; id < defs.size(); ++id)
+        {
+            if (defs[id] && states[id] == state::NEW)
+            {
+                emit(id);
+            }
+        }
+
+        for (auto const id : outputs)
+        {
+            if (id >= sig.size() || !sig[id])
+            {
+                throw std::runtime_error{"Primary output is not defined."};
+            }
+            nl.outputs.push_back(*sig[id]);
+        }
+        return nl;
+    }
+};
+
+}  // namespace detail
+
+// =====================================================================================================================
+// Functions
+// =====================================================================================================================
+
+// AIGER (ASCII "aag" and binary "aig"): latches are cut, i.e., their outputs become additional primary inputs and
+// their next-state functions additional primary outputs (after the regular ones).
+inline auto read_aiger(std::istream& is) -> netlist
+{
+    auto check = [&is](bool const cond) {
+        if (!is || !cond)
+        {
+            throw std::runtime_error{"The AIGER file is corrupt or uses unsupported features."};
+        }
+    };
+
+    std::string line;
+    std::getline(is, line);
+    std::istringstream header{line};
+    std::string fmt;
+    std::size_t m{}, i{}, l{}, o{}, a{};
+    header >> fmt >> m >> i >> l >> o >> a;
+    check(header && (fmt == "aag" || fmt == "aig") && i + l + a <= m);
+    for (std::size_t extra{}; header >> extra;)
+    {  // bad state properties, invariant constraints, justice properties, and fairness constraints
+        check(extra == 0);
+    }
+    auto const binary = fmt == "aig";
+
+    detail::netlist_builder nb;  // variables are IDs, negations are realized by additional IDs behind them
+    boost::unordered_flat_map<std::size_t, std::size_t> nots;
+    auto signal = [&](std::size_t const lit) {
+        check(lit >> 1u <= m);
+        if (lit == 0 || lit == 1)
+        {  // constant 0 is variable 0
+            if (nb.defs.empty() || !nb.defs[0])
+            {
+                nb.define(0, {}, {});
+            }
+        }
+        if ((lit & 1u) == 0)
+        {
+            return lit >> 1u;
+        }
+        auto [it, inserted] = nots.try_emplace(lit >> 1u, 0);
+        if (inserted)
+        {
+            it->second = std::max(m + 1, nb.defs.size());
+            nb.define(it->second, {lit >> 1u}, {.cubes = {"0"}, .onset = true});
+        }
+        return it->second;
+    };
+    auto read_lit = [&]() {
+        std::getline(is, line);
+        std::istringstream ls{line};
+        std::size_t lit{};
+        ls >> lit;
+        check(static_cast<bool>(ls));
+        return std::pair{lit, std::move(ls)};
+    };
+
+    for (auto k = 0uz; k < i; ++k)
+    {
+        auto lit = 2 * (k + 1);
+        if (!binary)
+        {
+            lit = read_lit().first;
+            check(lit >= 2 && (lit & 1u) == 0 && lit >> 1u <= m);
+        }
+        nb.inputs.push_back(lit >> 1u);
+    }
+    std::vector<std::size_t> nexts(l);  // next-state literals
+    for (auto k = 0uz; k < l; ++k)
+    {
+        auto lit = 2 * (i + k + 1);
+        auto [first, rest] = read_lit();
+        if (!binary)
+        {
+            lit = first;
+            rest >> first;
+            check(lit >= 2 && (lit & 1u) == 0 && lit >> 1u <= m && static_cast<bool>(rest));
+        }
+        nexts[k] = first;
+        nb.inputs.push_back(lit >> 1u);
+    }
+    std::vector<std::size_t> outs(o);
+    for (auto& lit : outs)
+    {
+        lit = read_lit().first;
+    }
+
+    auto and_gate = [&](std::size_t const lhs, std::size_t const rhs0, std::size_t const rhs1) {
+        check(lhs >= 2 && (lhs & 1u) == 0 && lhs >> 1u <= m);
+        auto const s0 = signal(rhs0 & ~1uz), s1 = signal(rhs1 & ~1uz);
+        nb.define(lhs >> 1u, {s0, s1},
+                  {.cubes = {std::string{(rhs0 & 1u) != 0 ? '0' : '1', (rhs1 & 1u) != 0 ? '0' : '1'}}, .onset = true});
+    };
+    for (auto k = 0uz; k < a; ++k)
+    {
+        if (binary)
+        {  // delta-encoded with the same 7-bit groups as read_varint
+            auto const lhs = 2 * (i + l + k + 1);
+            auto const rhs0 = lhs - detail::read_varint(is);
+            auto const rhs1 = rhs0 - detail::read_varint(is);
+            check(rhs0 < lhs && rhs1 <= rhs0);
+            and_gate(lhs, rhs0, rhs1);
+            continue;
+        }
+        std::getline(is, line);
+        std::istringstream ls{line};
+        std::size_t lhs{}, rhs0{}, rhs1{};
+        ls >> lhs >> rhs0 >> rhs1;
+        check(static_cast<bool>(ls));
+        and_gate(lhs, rhs0, rhs1);
+    }
+
+    for (auto const lit : outs)
+    {
+        nb.outputs.push_back(signal(lit));
+    }
+    for (auto const lit : nexts)
+    {
+        nb.outputs.push_back(signal(lit));
+    }
+    auto nl = nb.build();
+
+    // symbol table
+    nl.input_names.resize(i + l);
+    nl.output_names.resize(o + l);
+    for (auto k = 0uz; k < i + l; ++k)
+    {
+        nl.input_names[k] = k < i ? "i" + std::to_string(k) : "l" + std::to_string(k - i);
+    }
+    for (auto k = 0uz; k < o + l; ++k)
+    {
+        nl.output_names[k] = k < o ? "o" + std::to_string(k) : "l" + std::to_string(k - o) + "_next";
+    }
+    is.clear();  // the symbol table is optional
+    while (std::getline(is, line) && !line.empty() && line[0] != 'c')
+    {
+        auto const sep = line.find(' ');
+        if (sep == std::string::npos || sep < 2)
+        {
+            continue;
+        }
+        std::size_t pos{};
+        auto const [end, ec] = std::from_chars(line.data() + 1, line.data() + sep, pos);
+        check(ec == std::errc{} && end == line.data() + sep);
+        auto name = line.substr(sep + 1);
+        switch (line[0])
+        {
+            case 'i':
+                if (pos < i)
+                {
+                    nl.input_names[pos] = std::move(name);
+                }
+                break;
+            case 'o':
+                if (pos < o)
+                {
+                    nl.output_names[pos] = std::move(name);
+                }
+                break;
+            case 'l':
+                if (pos < l)
+                {
+                    nl.output_names[o + pos] = name + "_next";
+                    nl.input_names[i + pos] = std::move(name);
+                }
+                break;
+            default: break;
+        }
+    }
+    return nl;
+}
+
+// BLIF (a flat model of .names and .latch commands): latches are cut as for AIGER.
+inline auto read_blif(std::istream& is) -> netlist
+{
+    detail::netlist_builder nb;
+    boost::unordered_flat_map<std::string, std::size_t> ids;
+    std::vector<std::string> names;
+    auto id = [&ids, &names](std::string const& name) {
+        auto const [it, inserted] = ids.try_emplace(name, names.size());
+        if (inserted)
+        {
+            names.push_back(name);
+        }
+        return it->second;
+    };
+    auto fail = [](std::string_view const msg) { throw std::runtime_error{"BLIF: " + std::string{msg}}; };
+
+    std::vector<std::string> input_names, output_names, latch_outputs;
+    std::optional<std::pair<std::vector<std::size_t>, cover>> curr;  // .names being read
+    auto curr_id = 0uz;
+    auto finish = [&]() {
+        if (curr)
+        {
+            nb.define(curr_id, std::move(curr->first), std::move(curr->second));
+            curr.reset();
+        }
+    };
+
+    std::string line, logical;
+    while (std::getline(is, line))
+    {
+        if (auto const hash = line.find('#'); hash != std::string::npos)
+        {
+            line.erase(hash);
+        }
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!line.empty() && line.back() == '\\')
+        {  // continued on the next line
+            line.back() = ' ';
+            logical += line;
+            continue;
+        }
+        logical += line;
+
+        std::istringstream ls{logical};
+        logical.clear();
+        std::vector<std::string> tokens;
+        for (std::string token; ls >> token;)
+        {
+            tokens.push_back(std::move(token));
+        }
+        if (tokens.empty())
+        {
+            continue;
+        }
+
+        auto const& cmd = tokens[0];
+        if (cmd[0] != '.')
+        {  // row of the current cover
+            if (!curr)
+            {
+                fail("cover row outside of .names");
+            }
+            auto const n = curr->first.size();
+            auto const& pattern = n == 0 ? std::string{} : tokens[0];
+            auto const& bit = tokens.back();
+            if (tokens.size() != (n == 0 ? 1 : 2) || pattern.size() != n || (bit != "0" && bit != "1") ||
+                pattern.find_first_not_of("01-") != std::string::npos)
+            {
+                fail("malformed cover row");
+            }
+            if (!curr->second.cubes.empty() && curr->second.onset != (bit == "1"))
+            {
+                fail("cover mixes on-set and off-set rows");
+            }
+            curr->second.onset = bit == "1";
+            curr->second.cubes.push_back(pattern);
+            continue;
+        }
+
+        finish();
+        if (cmd == ".inputs")
+        {
+            input_names.insert(input_names.end(), tokens.begin() + 1, tokens.end());
+        }
+        else if (cmd == ".outputs")
+        {
+            output_names.insert(output_names.end(), tokens.begin() + 1, tokens.end());
+        }
+        else if (cmd == ".names")
+        {
+            if (tokens.size() < 2)
+            {
+                fail(".names without output");
+            }
+            std::vector<std::size_t> fanins;
+            for (auto k = 1uz; k + 1 < tokens.size(); ++k)
+            {
+                fanins.push_back(id(tokens[k]));
+            }
+            curr_id = id(tokens.back());
+            curr.emplace(std::move(fanins), cover{});
+        }
+        else if (cmd == ".latch")
+        {  // .latch input output [type control] [init]
+            if (tokens.size() < 3)
+            {
+                fail("malformed .latch");
+            }
+            latch_outputs.push_back(tokens[2]);
+            output_names.push_back(tokens[1]);
+        }
+        else if (cmd == ".end" || cmd == ".exdc")
+        {  // external don't cares are ignored
+            break;
+        }
+        else if (cmd == ".subckt" || cmd == ".gate" || cmd == ".mlatch" || cmd == ".search" || cmd == ".start_kiss")
+        {
+            fail("hierarchical, mapped, and FSM models are not supported");
+        }
+    }
+    finish();
+
+    for (auto const& name : input_names)
+    {
+        nb.inputs.push_back(id(name));
+    }
+    for (auto const& name : latch_outputs)
+    {
+        nb.inputs.push_back(id(name));
+    }
+    for (auto const& name : output_names)
+    {
+        nb.outputs.push_back(id(name));
+    }
+    auto nl = nb.build();
+    nl.input_names = std::move(input_names);
+    nl.input_names.insert(nl.input_names.end(), latch_outputs.begin(), latch_outputs.end());
+    nl.output_names = std::move(output_names);
+    return nl;
+}
+
+inline auto read_aiger(std::filesystem::path const& path)
+{
+    std::ifstream ifs{path, std::ios::binary};
+    if (!ifs)
+    {
+        throw std::runtime_error{"Cannot open " + path.string()};
+    }
+    return read_aiger(ifs);
+}
+
+inline auto read_blif(std::filesystem::path const& path)
+{
+    std::ifstream ifs{path};
+    if (!ifs)
+    {
+        throw std::runtime_error{"Cannot open " + path.string()};
+    }
+    return read_blif(ifs);
+}
+
+namespace detail
+{
+
+template <typename Manager, typename DD>
+auto simulate(Manager& mgr, netlist const& nl, std::vector<DD> const& inputs, std::vector<std::size_t> const& outs,
+              std::vector<std::vector<std::size_t>> const& lvls)
+{  // builds the cone of the given outputs level by level and releases signals as soon as they are no longer used
+    std::vector<bool> in_cone(nl.signal_count());
+    std::vector<std::size_t> fanouts(nl.signal_count());
+    std::vector<std::size_t> stack;
+    for (auto const s : outs)
+    {
+        ++fanouts[s];
+        stack.push_back(s);
+    }
+    while (!stack.empty())
+    {
+        auto const s = stack.back();
+        stack.pop_back();
+        if (in_cone[s])
+        {
+            continue;
+        }
+        in_cone[s] = true;
+        if (s >= nl.inputs)
+        {
+            for (auto const t : nl.gates[s - nl.inputs])
+            {
+                ++fanouts[t];
+                stack.push_back(t);
+            }
+        }
+    }
+
+    std::vector<DD> sigs(nl.signal_count());
+    for (auto s = 0uz; s < nl.inputs; ++s)
+    {
+        if (in_cone[s])
+        {
+            sigs[s] = inputs[s];
+        }
+    }
+    auto take = [&sigs, &fanouts](std::size_t const s) {
+        auto f = sigs[s];
+        if (--fanouts[s] == 0)
+        {  // last use
+            sigs[s] = DD{};
+        }
+        return f;
+    };
+
+    std::vector<DD> fs;
+    for (auto const& lvl : lvls)
+    {
+        for (auto const g : lvl)
+        {
+            auto const s = nl.inputs + g;
+            if (!in_cone[s])
+            {
+                continue;
+            }
+
+            fs.clear();
+            for (auto const t : nl.gates[g])
+            {
+                fs.push_back(take(t));
+            }
+            auto f = mgr.zero();
+            for (auto const& cube : nl.covers[g].cubes)
+            {
+                auto p = mgr.one();
+                for (auto k = 0uz; k < cube.size(); ++k)
+                {
+                    if (cube[k] == '1')
+                    {
+                        p &= fs[k];
+                    }
+                    else if (cube[k] == '0')
+                    {
+                        p &= ~fs[k];
+                    }
+                }
+                f |= p;
+            }
+            sigs[s] = nl.covers[g].onset ? f : ~f;
+        }
+    }
+
+    std::vector<DD> res;
+    res.reserve(outs.size());
+    for (auto const s : outs)
+    {
+        res.push_back(take(s));
+    }
+    return res;
+}
+
+}  // namespace detail
+
+// Symbolic simulation of a netlist with covers, where inputs[i] is the DD of primary input i (e.g., a variable). If
+// threads > 1, the outputs are distributed among managers of the same type that build their cones independently. The
+// results are then loaded into mgr, which requires DD types supporting save/load.
+template <typename Manager>
+auto simulate(Manager& mgr, netlist const& nl, std::vector<decltype(std::declval<Manager&>().zero())> const& inputs,
+              std::size_t const threads = 1)
+{
+    using dd = decltype(mgr.zero());
+
+    assert(inputs.size() == nl.inputs);
+    assert(nl.covers.size() == nl.gates.size());
+    assert(threads > 0);
+
+    // levelized schedule
+    std::vector<std::size_t> depths(nl.signal_count());
+    std::vector<std::vector<std::size_t>> lvls;
+    for (auto g = 0uz; g < nl.gates.size(); ++g)
+    {
+        auto& d = depths[nl.inputs + g];
+        for (auto const s : nl.gates[g])
+        {
+            assert(s < nl.inputs + g);  // topologically sorted
+
+            d = std::max(d, depths[s] + 1);
+        }
+        d = std::max(d, 1uz);
+        if (d > lvls.size())
+        {
+            lvls.resize(d);
+        }
+        lvls[d - 1].push_back(g);
+    }
+
+    if (threads == 1 || nl.outputs.size() < 2)
+    {
+        return detail::simulate(mgr, nl, inputs, nl.outputs, lvls);
+    }
+
+    std::ostringstream oss;
+    mgr.save(inputs, oss);
+    auto const ins = oss.str();
+    auto cfg = mgr.config();
+    cfg.dyn_reorder = reorder_method::NONE;  // as loading the results would establish the order of a worker
+    auto const workers = std::min(threads, nl.outputs.size());
+    std::vector<std::string> results(workers);
+    std::vector<std::exception_ptr> errors(workers);
+    detail::parallel_for(0uz, workers, [&](std::size_t const w) {
+        try
+        {
+            Manager local{cfg};
+            std::istringstream iss{ins};
+            auto const fs = local.load(iss);
+            std::vector<std::size_t> outs;
+            for (auto k = w; k < nl.outputs.size(); k += workers)
+            {  // round-robin to balance large and small cones
+                outs.push_back(nl.outputs[k]);
+            }
+            std::ostringstream res;
+            local.save(detail::simulate(local, nl, fs, outs, lvls), res);
+            results[w] = res.str();
+        }
+        catch (...)
+        {
+            errors[w] = std::current_exception();
+        }
+    });
+    for (auto const& e : errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+
+    std::vector<dd> outputs(nl.outputs.size());
+    for (auto w = 0uz; w < workers; ++w)
+    {
+        std::istringstream iss{results[w]};
+        auto const fs = mgr.load(iss);
+        for (auto k = 0uz; k < fs.size(); ++k)
+        {
+            outputs[w + k * workers] = fs[k];
+        }
+    }
+    return outputs;
+}
+
+}  // namespace freddy
@@ -0,0 +1,228 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/config.hpp"   // var_index
+#include "freddy/netlist.hpp"  // netlist
+
+#include <algorithm>  // std::ranges::sort
+#include <cassert>    // assert
+#include <cstddef>    // std::size_t
+#include <limits>     // std::numeric_limits
+#include <numeric>    // std::iota
+#include <ranges>     // std::views::transform
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Functions
+// =====================================================================================================================
+
+// The following heuristics return the primary inputs top-down, i.e., in the order in which the corresponding DD
+// variables should be created. Alternatively, the result can be passed to manager::permute if the variables were
+// created in the order of the primary inputs.
+
+inline auto dfs_order(netlist const& nl) -> std::vector<var_index>
+{  // inputs in the order of their first visit by a DFS from the outputs, whereby deeper fan-ins are visited first
+    assert(nl.inputs <= std::numeric_limits<var_index>::max());
+
+    std::vector<std::size_t> depths(nl.signal_count());  // 0 for primary inputs
+    for (auto i = 0uz; i < nl.gates.size(); ++i)
+    {
+        for (auto const s : nl.gates[i])
+        {
+            assert(s < nl.inputs + i);  // topologically sorted
+
+            depths[nl.inputs + i] = std::max(depths[nl.inputs + i], depths[s] + 1);
+        }
+    }
+
+    std::vector<var_index> order;
+    order.reserve(nl.inputs);
+    std::vector<bool> visited(nl.signal_count());
+    auto visit = [&](std::size_t const s) {
+        std::vector<std::pair<std::size_t, std::vector<std::size_t>>> stack;  // (signal, fan-ins still to be visited)
+        auto push = [&](std::size_t const t) {
+            visited[t] = true;
+            if (t < nl.inputs)
+            {
+                order.push_back(static_cast<var_index>(t));
+                return;
+            }
+            auto fanins = nl.gates[t - nl.inputs];
+            std::ranges::stable_sort(fanins, [&depths](std::size_t const a, std::size_t const b) {
+                return depths[a] < depths[b];  // deepest fan-in ends up on top of the stack
+            });
+            stack.emplace_back(t, std::move(fanins));
+        };
+
+        push(s);
+        while (!stack.empty())
+        {  // iteratively, as circuits can be deep
+            auto& fanins = stack.back().second;
+            if (fanins.empty())
+            {
+                stack.pop_back();
+                continue;
+            }
+            auto const t = fanins.back();
+            fanins.pop_back();
+            if (!visited[t])
+            {
+                push(t);
+            }
+        }
+    };
+
+    for (auto const s : nl.outputs)
+    {
+        assert(s < nl.signal_count());
+
+        if (!visited[s])
+        {
+            visit(s);
+        }
+    }
+    for (auto s = 0uz; s < nl.inputs; ++s)
+    {  // inputs not affecting any output
+        if (!visited[s])
+        {
+            order.push_back(static_cast<var_index>(s));
+        }
+    }
+
+    assert(order.size() == nl.inputs);
+    return order;
+}
+
+inline auto force_order(netlist const& nl, std::size_t const max_iters = 64) -> std::vector<var_index>
+{  // FORCE: signals are placed at the average center of gravity of the gates (hyperedges) they are connected to
+    assert(nl.inputs <= std::numeric_limits<var_index>::max());
+
+    auto const n = nl.signal_count();
+
+    // gate i connects its fan-ins with the signal it drives
+    std::vector<std::vector<std::size_t>> edges(n);  // hyperedges per signal
+    for (auto i = 0uz; i < nl.gates.size(); ++i)
+    {
+        edges[nl.inputs + i].push_back(i);
+        for (auto const s : nl.gates[i])
+        {
+            edges[s].push_back(i);
+        }
+    }
+
+    // initial placement: inputs according to the DFS order, gates behind their fan-ins
+    std::vector<double> pos(n);
+    auto const init = dfs_order(nl);
+    for (auto i = 0uz; i < init.size(); ++i)
+    {
+        pos[init[i]] = static_cast<double>(i);
+    }
+    for (auto i = 0uz; i < nl.gates.size(); ++i)
+    {
+        auto const& fanins = nl.gates[i];
+        auto const at = [&pos](std::size_t const s) { return pos[s]; };
+        pos[nl.inputs + i] = fanins.empty() ? 0.0 : std::ranges::max(fanins | std::views::transform(at)) + 0.5;
+    }
+
+    std::vector<std::size_t> signals(n);
+    std::iota(signals.begin(), signals.end(), 0uz);
+    auto rank = [&pos, &signals]() {  // positions are normalized to ranks
+        std::ranges::stable_sort(signals, [&pos](std::size_t const a, std::size_t const b) { return pos[a] < pos[b]; });
+        for (auto i = 0uz; i < signals.size(); ++i)
+        {
+            pos[signals[i]] = static_cast<double>(i);
+        }
+    };
+    auto span = [&nl, &pos]() {  // total extent of all hyperedges
+        auto sum = 0.0;
+        for (auto i = 0uz; i < nl.gates.size(); ++i)
+        {
+            auto lo = pos[nl.inputs + i];
+            auto hi = lo;
+            for (auto const s : nl.gates[i])
+            {
+                lo = std::min(lo, pos[s]);
+                hi = std::max(hi, pos[s]);
+            }
+            sum += hi - lo;
+        }
+        return sum;
+    };
+
+    rank();
+    auto best_pos = pos;
+    auto best_span = span();
+    std::vector<double> cogs(nl.gates.size());
+    for (auto iter = 0uz; iter < max_iters; ++iter)
+    {
+        for (auto i = 0uz; i < nl.gates.size(); ++i)
+        {
+            auto sum = pos[nl.inputs + i];
+            for (auto const s : nl.gates[i])
+            {
+                sum += pos[s];
+            }
+            cogs[i] = sum / static_cast<double>(nl.gates[i].size() + 1);
+        }
+        for (auto s = 0uz; s < n; ++s)
+        {
+            if (!edges[s].empty())
+            {  // unconnected signals keep their position
+                auto sum = 0.0;
+                for (auto const i : edges[s])
+                {
+                    sum += cogs[i];
+                }
+                pos[s] = sum / static_cast<double>(edges[s].size());
+            }
+        }
+        rank();
+
+        auto const curr_span = span();
+        if (curr_span >= best_span)
+        {  // converged
+            break;
+        }
+        best_span = curr_span;
+        best_pos = pos;
+    }
+
+    std::vector<var_index> order(nl.inputs);
+    std::iota(order.begin(), order.end(), var_index{});
+    std::ranges::stable_sort(order,
+                             [&best_pos](var_index const a, var_index const b) { return best_pos[a] < best_pos[b]; });
+    return order;
+}
+
+inline auto interleave(std::vector<std::vector<var_index>> const& words) -> std::vector<var_index>
+{  // bits of word-level operands (LSB first as for unsigned_bin) alternate, starting with the most significant ones
+    assert(!words.empty());
+
+    auto const width = std::ranges::max(words | std::views::transform([](auto const& w) { return w.size(); }));
+
+    std::vector<var_index> order;
+    for (auto i = width; i-- > 0;)
+    {
+        for (auto const& w : words)
+        {
+            if (i < w.size())
+            {
+                order.push_back(w[i]);
+            }
+        }
+    }
+    return order;
+}
+
+}  // namespace freddy
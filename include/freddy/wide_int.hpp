@@ -0,0 +1,520 @@
+#pragma once
+
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include "freddy/detail/common.hpp"  // detail::write_varint
+
+#include <algorithm>   // std::ranges::reverse
+#include <bit>         // std::countr_zero
+#include <cassert>     // assert
+#include <compare>     // std::strong_ordering
+#include <concepts>    // std::integral
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <functional>  // std::hash
+#include <istream>     // std::istream
+#include <memory>      // std::shared_ptr
+#include <ostream>     // std::ostream
+#include <string>      // std::string
+#include <utility>     // std::pair
+#include <vector>      // std::vector
+
+#ifdef __SIZEOF_INT128__  // GCC and Clang
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+namespace freddy
+{
+
+// =====================================================================================================================
+// Aliases
+// =====================================================================================================================
+
+namespace detail
+{
+
+__extension__ using int128 = __int128;  // __extension__ silences -pedantic
+
+__extension__ using uint128 = unsigned __int128;
+
+}  // namespace detail
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+// Signed integer of arbitrary precision, e.g., for BMD weights when verifying multipliers beyond 32 bits. Values that
+// fit into 128 bits are stored inline and computed with native instructions. Larger values spill into an immutable
+// magnitude on the heap, which is shared by copies.
+class wide_int final
+{
+  public:
+    wide_int() noexcept = default;
+
+    template <std::integral T>
+    // NOLINTNEXTLINE(google-explicit-constructor) to mimic built-in integers
+    wide_int(T const n) noexcept :
+            small{n}
+    {}
+
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    wide_int(detail::int128 const n) noexcept :
+            small{n}
+    {}
+
+    explicit operator bool() const noexcept
+    {
+        return small != 0 || ext;
+    }
+
+    auto operator+=(wide_int const& rhs) -> wide_int&
+    {
+        return *this = *this + rhs;
+    }
+
+    auto operator-=(wide_int const& rhs) -> wide_int&
+    {
+        return *this = *this - rhs;
+    }
+
+    auto operator*=(wide_int const& rhs) -> wide_int&
+    {
+        return *this = *this * rhs;
+    }
+
+    auto operator/=(wide_int const& rhs) -> wide_int&
+    {
+        return *this = *this / rhs;
+    }
+
+    friend auto operator-(wide_int const& a) -> wide_int
+    {
+        if (!a.ext && a.small != min)
+        {
+            return -a.small;
+        }
+        auto [neg, mag] = a.split();
+        return make(!neg, std::move(mag));
+    }
+
+    friend auto operator+(wide_int const& a, wide_int const& b) -> wide_int
+    {
+        if (detail::int128 r{}; !a.ext && !b.ext && !__builtin_add_overflow(a.small, b.small, &r))
+        {
+            return r;
+        }
+        return add(a.split(), b.split());
+    }
+
+    friend auto operator-(wide_int const& a, wide_int const& b) -> wide_int
+    {
+        if (detail::int128 r{}; !a.ext && !b.ext && !__builtin_sub_overflow(a.small, b.small, &r))
+        {
+            return r;
+        }
+        auto [neg, mag] = b.split();
+        return add(a.split(), {!neg, std::move(mag)});
+    }
+
+    friend auto operator*(wide_int const& a, wide_int const& b) -> wide_int
+    {
+        if (!a.ext && !b.ext && fits64(a.small) && fits64(b.small))
+        {  // common case, which cannot overflow
+            return a.small * b.small;
+        }
+        auto const [a_neg, a_mag] = a.split();
+        auto const [b_neg, b_mag] = b.split();
+        return make(a_neg != b_neg, mul(a_mag, b_mag));
+    }
+
+    friend auto operator/(wide_int const& a, wide_int const& b) -> wide_int  // truncating
+    {
+        assert(b != 0);
+
+        if (!a.ext && !b.ext && (a.small != min || b.small != -1))
+        {
+            return a.small / b.small;
+        }
+        auto const [a_neg, a_mag] = a.split();
+        auto const [b_neg, b_mag] = b.split();
+        return make(a_neg != b_neg, divmod(a_mag, b_mag).first);
+    }
+
+    friend auto operator==(wide_int const& a, wide_int const& b) noexcept -> bool
+    {
+        if (!a.ext || !b.ext)
+        {  // spilled values never fit into 128 bits
+            return !a.ext && !b.ext && a.small == b.small;
+        }
+        return a.ext->neg == b.ext->neg && a.ext->mag == b.ext->mag;
+    }
+
+    friend auto operator<=>(wide_int const& a, wide_int const& b) -> std::strong_ordering
+    {
+        if (!a.ext && !b.ext)
+        {
+            if (a.small == b.small)
+            {
+                return std::strong_ordering::equal;
+            }
+            return a.small < b.small ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        auto const [a_neg, a_mag] = a.split();
+        auto const [b_neg, b_mag] = b.split();
+        if (a_neg != b_neg)
+        {
+            return a_neg ? std::strong_ordering::less : std::strong_ordering::greater;
+        }
+        auto const c = a_neg ? cmp(b_mag, a_mag) : cmp(a_mag, b_mag);
+        return c <=> 0;
+    }
+
+    friend auto operator<<(std::ostream& os, wide_int const& a) -> std::ostream&
+    {
+        auto [neg, mag] = a.split();
+        std::string s;
+        do
+        {  // chunks of 19 decimal digits
+            auto r = divmod(mag, 10'000'000'000'000'000'000u);
+            for (auto i = 0; i < 19 && (r != 0 || !mag.empty()); ++i, r /= 10)
+            {
+                s.push_back(static_cast<char>('0' + (r % 10)));
+            }
+        } while (!mag.empty());
+        if (s.empty())
+        {
+            s.push_back('0');
+        }
+        if (neg)
+        {
+            s.push_back('-');
+        }
+        std::ranges::reverse(s);
+        return os << s;
+    }
+
+    friend auto abs(wide_int const& a) -> wide_int
+    {
+        return a < 0 ? -a : a;
+    }
+
+    friend auto gcd(wide_int const& a, wide_int const& b) -> wide_int  // non-negative
+    {
+        if (!a.ext && !b.ext && a.small != min && b.small != min)
+        {  // binary GCD, which only requires shifts and subtractions
+            auto u = static_cast<detail::uint128>(a.small < 0 ? -a.small : a.small);
+            auto v = static_cast<detail::uint128>(b.small < 0 ? -b.small : b.small);
+            if (u == 0 || v == 0)
+            {
+                return static_cast<detail::int128>(u | v);
+            }
+            auto const k = ctz(u | v);
+            u >>= ctz(u);
+            do
+            {
+                v >>= ctz(v);
+                if (u > v)
+                {
+                    std::swap(u, v);
+                }
+                v -= u;
+            } while (v != 0);
+            return make(false, {static_cast<std::uint64_t>(u << k), static_cast<std::uint64_t>((u << k) >> 64u)});
+        }
+
+        auto u = a.split().second;
+        auto v = b.split().second;
+        while (!v.empty())
+        {  // Euclidean algorithm
+            u = divmod(u, v).second;
+            std::swap(u, v);
+        }
+        return make(false, std::move(u));
+    }
+
+    [[nodiscard]] auto hash() const noexcept -> std::size_t
+    {
+        if (!ext)
+        {  // the upper half is only the sign extension for most weights
+            auto const u = static_cast<detail::uint128>(small);
+            auto const hi = static_cast<std::uint64_t>(u >> 64u);
+            return std::hash<std::uint64_t>{}(static_cast<std::uint64_t>(u) ^ (hi * detail::P1));
+        }
+        auto h = static_cast<std::size_t>(ext->neg);
+        for (auto const l : ext->mag)
+        {
+            h = h * detail::P2 + std::hash<std::uint64_t>{}(l);
+        }
+        return h;
+    }
+
+    [[nodiscard]] auto is_inline() const noexcept  // Does the value fit into 128 bits?
+    {
+        return !ext;
+    }
+
+    auto write(std::ostream& os) const  // sign and magnitude
+    {
+        auto const [neg, mag] = split();
+        detail::write_varint(os, (mag.size() << 1u) | static_cast<std::uint64_t>(neg));
+        for (auto const l : mag)
+        {
+            detail::write_varint(os, l);
+        }
+    }
+
+    static auto read(std::istream& is)  // counterpart of write
+    {
+        auto const head = detail::read_varint(is);
+        limbs mag;
+        for (auto i = 0uz; i < head >> 1u && is; ++i)
+        {  // the limb count is not trusted to allocate upfront, as the input may be corrupted
+            mag.push_back(detail::read_varint(is));
+        }
+        while (!mag.empty() && mag.back() == 0)
+        {  // to be robust against corrupted input
+            mag.pop_back();
+        }
+        return make((head & 1u) != 0, std::move(mag));
+    }
+
+  private:
+    using limbs = std::vector<std::uint64_t>;  // magnitude, least significant limb first, without leading zeros
+
+    struct big final
+    {
+        bool neg;
+
+        limbs mag;
+    };
+
+    static constexpr auto min = static_cast<detail::int128>(static_cast<detail::uint128>(1) << 127u);
+
+    static auto fits64(detail::int128 const n) noexcept -> bool
+    {
+        return n >= INT64_MIN && n <= INT64_MAX;
+    }
+
+    static auto ctz(detail::uint128 const n) noexcept -> int
+    {
+        auto const lo = static_cast<std::uint64_t>(n);
+        return lo != 0 ? std::countr_zero(lo) : 64 + std::countr_zero(static_cast<std::uint64_t>(n >> 64u));
+    }
+
+    static auto make(bool const neg, limbs mag) -> wide_int  // normalizes the representation
+    {
+        while (!mag.empty() && mag.back() == 0)
+        {
+            mag.pop_back();
+        }
+        if (mag.size() <= 2)
+        {
+            detail::uint128 u{};
+            for (auto i = mag.size(); i-- > 0;)
+            {
+                u = (u << 64u) | mag[i];
+            }
+            if (u < static_cast<detail::uint128>(min) || (neg && u == static_cast<detail::uint128>(min)))
+            {
+                return neg ? static_cast<detail::int128>(-u) : static_cast<detail::int128>(u);
+            }
+        }
+
+        wide_int res;
+        res.ext = std::make_shared<big const>(neg, std::move(mag));
+        return res;
+    }
+
+    [[nodiscard]] auto split() const -> std::pair<bool, limbs>
+    {
+        if (ext)
+        {
+            return {ext->neg, ext->mag};
+        }
+
+        auto const u = small < 0 ? -static_cast<detail::uint128>(small) : static_cast<detail::uint128>(small);
+        limbs mag{static_cast<std::uint64_t>(u), static_cast<std::uint64_t>(u >> 64u)};
+        while (!mag.empty() && mag.back() == 0)
+        {
+            mag.pop_back();
+        }
+        return {small < 0, std::move(mag)};
+    }
+
+    static auto cmp(limbs const& a, limbs const& b) noexcept -> int
+    {
+        if (a.size() != b.size())
+        {
+            return a.size() < b.size() ? -1 : 1;
+        }
+        for (auto i = a.size(); i-- > 0;)
+        {
+            if (a[i] != b[i])
+            {
+                return a[i] < b[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    static auto add(std::pair<bool, limbs> const& a, std::pair<bool, limbs> const& b) -> wide_int
+    {
+        if (a.first == b.first)
+        {
+            limbs sum(std::max(a.second.size(), b.second.size()) + 1);
+            detail::uint128 carry{};
+            for (auto i = 0uz; i < sum.size(); ++i)
+            {
+                carry += i < a.second.size() ? a.second[i] : 0;
+                carry += i < b.second.size() ? b.second[i] : 0;
+                sum[i] = static_cast<std::uint64_t>(carry);
+                carry >>= 64u;
+            }
+            return make(a.first, std::move(sum));
+        }
+
+        auto const c = cmp(a.second, b.second);
+        if (c == 0)
+        {
+            return 0;
+        }
+        return c > 0 ? make(a.first, sub(a.second, b.second)) : make(b.first, sub(b.second, a.second));
+    }
+
+    static auto sub(limbs a, limbs const& b) -> limbs  // requires a >= b
+    {
+        std::uint64_t borrow{};
+        for (auto i = 0uz; i < a.size(); ++i)
+        {
+            auto const d = i < b.size() ? b[i] : 0;
+            auto const r = a[i] - d - borrow;
+            borrow = a[i] < d || (a[i] == d && borrow != 0) ? 1 : 0;
+            a[i] = r;
+        }
+        assert(borrow == 0);
+
+        return a;
+    }
+
+    static auto mul(limbs const& a, limbs const& b) -> limbs  // schoolbook, as operands are short
+    {
+        limbs prod(a.size() + b.size());
+        for (auto i = 0uz; i < a.size(); ++i)
+        {
+            detail::uint128 carry{};
+            for (auto j = 0uz; j < b.size(); ++j)
+            {
+                carry += static_cast<detail::uint128>(a[i]) * b[j] + prod[i + j];
+                prod[i + j] = static_cast<std::uint64_t>(carry);
+                carry >>= 64u;
+            }
+            prod[i + b.size()] = static_cast<std::uint64_t>(carry);
+        }
+        return prod;
+    }
+
+    static auto divmod(limbs& a, std::uint64_t const d) -> std::uint64_t  // quotient in place, returns remainder
+    {
+        assert(d != 0);
+
+        detail::uint128 r{};
+        for (auto i = a.size(); i-- > 0;)
+        {
+            r = (r << 64u) | a[i];
+            a[i] = static_cast<std::uint64_t>(r / d);
+            r %= d;
+        }
+        while (!a.empty() && a.back() == 0)
+        {
+            a.pop_back();
+        }
+        return static_cast<std::uint64_t>(r);
+    }
+
+    static auto divmod(limbs const& a, limbs const& b) -> std::pair<limbs, limbs>  // quotient and remainder
+    {
+        assert(!b.empty());
+
+        if (b.size() == 1)
+        {
+            auto q = a;
+            auto const r = divmod(q, b[0]);
+            return {std::move(q), r == 0 ? limbs{} : limbs{r}};
+        }
+
+        // binary long division, which suffices as huge weights are rare
+        limbs q(a.size()), r;
+        for (auto i = a.size() * 64; i-- > 0;)
+        {
+            auto carry = (a[i / 64] >> (i % 64)) & 1u;  // r = 2r + bit i of a
+            for (auto& l : r)
+            {
+                auto const next = l >> 63u;
+                l = (l << 1u) | carry;
+                carry = next;
+            }
+            if (carry != 0)
+            {
+                r.push_back(carry);
+            }
+
+            if (cmp(r, b) >= 0)
+            {
+                r = sub(std::move(r), b);
+                while (!r.empty() && r.back() == 0)
+                {
+                    r.pop_back();
+                }
+                q[i / 64] |= std::uint64_t{1} << (i % 64);
+            }
+        }
+        while (!q.empty() && q.back() == 0)
+        {
+            q.pop_back();
+        }
+        return {std::move(q), std::move(r)};
+    }
+
+    detail::int128 small{};
+
+    std::shared_ptr<big const> ext;  // set iff the value does not fit into 128 bits
+};
+
+namespace detail
+{
+
+template <>
+inline auto write_bin(std::ostream& os, wide_int const& val)
+{
+    val.write(os);
+}
+
+template <>
+inline auto read_bin<wide_int>(std::istream& is) -> wide_int
+{
+    return wide_int::read(is);
+}
+
+}  // namespace detail
+
+}  // namespace freddy
+
+namespace std
+{
+
+template <>
+struct hash<freddy::wide_int> final
+{
+    auto operator()(freddy::wide_int const& val) const noexcept
+    {
+        return val.hash();
+    }
+};
+
+}  // namespace std
+
+#endif
@@ -141,6 +141,18 @@ TEST_CASE("ADD can be characterized", "[basic]")
         CHECK(f.path_count() == 8);
     }
 
+    SECTION("Extrema are determined")
+    {
+        auto const g = f - mgr.constant(3) * x0 * x2;
+
+        CHECK(f.min() == 0);
+        CHECK(f.max() == 7);
+        CHECK(g.min() == 0);
+        CHECK(g.max() == 6);
+        CHECK(g.eval(g.argmin()) == 0);
+        CHECK((mgr.constant(5) - f).argmin() == std::vector{true, true, true});
+    }
+
     SECTION("Essential variables are identifiable")
     {
         mgr.var();
@@ -256,3 +268,61 @@ TEST_CASE("ADD detects misuse of word-level operations", "[basic]")
         CHECK_THROWS_AS(fc + fmgr.constant(std::ldexp(std::numeric_limits<float>::max(), -1)), std::overflow_error);
     }
 }
+
+TEST_CASE("ADD can be saved and loaded", "[basic]")
+{
+    add_manager<double> mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("x0"), x1 = mgr.var("x1"), x2 = mgr.var("x2"), x3 = mgr.var("x3");
+    std::vector<add<double>> const fs{x0 * x1 - mgr.constant(0.75) * x2 + x3, (x0 & x1) | (x2 & x3)};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        add_manager<double> other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the same DDs")
+    {
+        CHECK(mgr.load(ss) == fs);
+    }
+}
+
+TEST_CASE("ADD operands are combined n-ary", "[basic]")
+{
+    add_manager<std::int32_t> mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 3}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var();
+    std::vector<add<std::int32_t>> const fs{x0 + mgr.two(), x1 * x2, mgr.constant(3) * x0 + x1, x2 + mgr.one()};
+
+    CHECK(mgr.sum_all(fs) == ((fs[0] + fs[1]) + fs[2]) + fs[3]);
+    CHECK(mgr.product_all(fs) == ((fs[0] * fs[1]) * fs[2]) * fs[3]);
+    CHECK(mgr.sum_all({}) == mgr.zero());
+    CHECK(mgr.product_all({}) == mgr.one());
+}
+
+TEST_CASE("ADD multiplexes words", "[basic]")
+{
+    add_manager<std::int32_t> mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var(), x3 = mgr.var();
+    auto const sel = x0 | (x1 & ~x3);
+    auto const g = x1 + mgr.two() * x2 + mgr.constant(4) * x3, h = mgr.constant(7) - x0 * x2;
+
+    CHECK(sel.ite(g, h) == h + sel * (g - h));
+    CHECK(sel.ite(mgr.constant(5), mgr.constant(-3)) == mgr.constant(-3) + mgr.constant(8) * sel);
+    CHECK(x2.ite(sel.ite(g, h), g) == g + x2 * (h + sel * (g - h) - g));
+}
@@ -4,11 +4,23 @@
 
 #include <catch2/catch_test_macros.hpp>  // TEST_CASE
 
-#include <freddy/config.hpp>  // config
-#include <freddy/dd/bdd.hpp>  // bdd_manager
-
-#include <sstream>  // std::ostringstream
-#include <vector>   // std::vector
+#include <freddy/config.hpp>     // config
+#include <freddy/dd/bdd.hpp>     // bdd_manager
+#include <freddy/dd/bmd.hpp>     // bmd_manager
+#include <freddy/dd/kfdd.hpp>    // kfdd_manager
+#include <freddy/expansion.hpp>  // expansion::pD
+
+#include <algorithm>  // std::ranges::count
+#include <array>      // std::array
+#include <cstdint>    // std::uint64_t
+#include <iterator>   // std::ranges::distance
+#include <limits>     // std::numeric_limits
+#include <random>     // std::mt19937_64
+#include <ranges>     // std::views::take
+#include <sstream>    // std::ostringstream
+#include <stdexcept>  // std::invalid_argument
+#include <utility>    // std::pair
+#include <vector>     // std::vector
 
 // *********************************************************************************************************************
 // Namespaces
@@ -192,6 +204,182 @@ TEST_CASE("BDD variable order is changeable", "[basic]")
         CHECK_FALSE(f.eval({true, false, false, true}));
         CHECK_FALSE(f.eval({false, true, true, false}));
     }
+
+    SECTION("Converging sifting finds a minimum")
+    {
+        mgr.reorder(reorder_method::SIFT_CONV);
+
+        CHECK(f.size() == 5);
+        CHECK(f.eval({false, true, false, true}));
+        CHECK_FALSE(f.eval({false, true, true, false}));
+    }
+
+    SECTION("Symmetric variables are sifted together")
+    {
+        mgr.reorder(reorder_method::SYMM_SIFT);
+
+        CHECK(f.size() == 5);
+        CHECK((mgr.level(0) + 1 == mgr.level(2) || mgr.level(2) + 1 == mgr.level(0)));  // x1 and x0
+        CHECK(f.eval({true, false, true, false}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+
+        mgr.swap(0, 1);  // temporary groups do not persist
+
+        CHECK(f.eval({false, true, false, true}));
+    }
+
+    SECTION("Candidate methods are tried in parallel")
+    {
+        auto const prev_size = f.size();
+        mgr.reorder_parallel({reorder_method::WINDOW2, reorder_method::SIFT, reorder_method::EXACT});
+
+        CHECK(prev_size > f.size());
+        CHECK(f.size() == 5);
+        CHECK(f.eval({true, false, true, false}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+        CHECK_THROWS_AS(mgr.reorder_parallel({reorder_method::SIFT, reorder_method::DTL_SIFT}), std::invalid_argument);
+    }
+
+    SECTION("Window permutation finds a minimum")
+    {
+        auto const prev_size = f.size();
+        mgr.reorder(reorder_method::WINDOW3);
+
+        CHECK(prev_size > f.size());
+        CHECK(f.eval({true, false, true, false}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+    }
+
+    SECTION("Exact reordering finds the minimum")
+    {
+        mgr.reorder(reorder_method::EXACT);
+
+        CHECK(f.size() == 5);
+        CHECK(f.eval({false, true, false, true}));
+        CHECK_FALSE(f.eval({false, true, true, false}));
+    }
+
+    SECTION("Order can be permuted")
+    {
+        auto const prev_order = mgr.order();
+        auto const prev_size = f.size();
+        mgr.permute(std::vector<var_index>{2, 0, 3, 1});  // x0 x1 x2 x3
+
+        CHECK(f.size() == 5);
+        CHECK(mgr.level(3) == 2);
+        CHECK(f.eval({true, false, true, false}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+
+        mgr.permute(prev_order);
+
+        CHECK(mgr.order() == prev_order);
+        CHECK(f.size() == prev_size);
+    }
+
+    SECTION("Groups are moved as units")
+    {
+        mgr.group({0, 1});  // x1 and x3
+        mgr.reorder();
+
+        CHECK((mgr.level(0) + 1 == mgr.level(1)));
+        CHECK(f.eval({true, false, true, false}));
+        CHECK(f.eval({false, true, false, true}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+        CHECK_FALSE(f.eval({false, true, true, false}));
+
+        mgr.ungroup(1);
+        mgr.reorder();
+
+        CHECK(f.size() == 5);
+    }
+
+    SECTION("Groups are not split by permutations")
+    {
+        mgr.group({0, 1});  // x1 and x3
+        auto const prev_order = mgr.order();
+
+        CHECK_THROWS_AS(mgr.permute(std::vector<var_index>{0, 2, 1, 3}), std::invalid_argument);
+        CHECK(mgr.order() == prev_order);
+
+        mgr.permute(std::vector<var_index>{2, 1, 0, 3});  // the group is kept together
+
+        CHECK(mgr.level(0) == 2);
+        CHECK(mgr.level(1) == 1);
+        CHECK(f.eval({true, false, true, false}));
+        CHECK_FALSE(f.eval({true, false, false, true}));
+    }
+
+    SECTION("DTL sifting is rejected")
+    {
+        auto const prev_order = mgr.order();
+
+        CHECK_THROWS_AS(mgr.reorder(reorder_method::DTL_SIFT), std::invalid_argument);
+        CHECK(mgr.order() == prev_order);
+        CHECK(mgr.decomposition(0) == expansion::S);
+    }
+
+    SECTION("Reordering respects its budget")
+    {
+        auto const prev_size = f.size();
+        mgr.config().max_swaps = 0;
+        mgr.reorder();
+
+        CHECK(prev_size == f.size());
+        CHECK(f.var() == 0);
+        CHECK(f.eval({true, false, true, false}));
+    }
+}
+
+TEST_CASE("BDD is reordered dynamically", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 8}};
+    std::vector<bdd> xs(8);
+    std::ranges::generate(xs, [&mgr]() { return mgr.var(); });
+    auto const f = (xs[0] & xs[1]) | (xs[2] & xs[3]);
+    mgr.gc();
+
+    SECTION("Churn below the threshold does not thrash GC")
+    {
+        mgr.config().dyn_reorder = reorder_method::SIFT;
+        mgr.config().reorder_thresh = mgr.node_count() + 8;  // live nodes stay just below
+        auto const prev_order = mgr.order();
+        auto const prev_gcs = mgr.gc_count();
+        auto sat = 0.0;
+        for (auto i = 0uz; i < 2'000; ++i)
+        {
+            sat += ((xs[i % 8] & xs[(i + 3) % 8]) ^ xs[(i + 5) % 8]).sharpsat();
+        }
+
+        CHECK(sat == 2'000 * 128.0);  // half of all 256 assignments each
+        CHECK(mgr.dyn_reorder_count() == 0);
+        CHECK(mgr.order() == prev_order);
+        CHECK(mgr.gc_count() - prev_gcs < 100);  // rather than about one GC per operation
+    }
+
+    SECTION("DTL sifting is rejected")
+    {
+        bdd_manager mgr2{{.utable_size_hint = 25, .cache_size_hint = 3'359, .dyn_reorder = reorder_method::DTL_SIFT}};
+
+        CHECK_THROWS_AS(mgr2.var(), std::invalid_argument);
+
+        mgr.config().dyn_reorder = reorder_method::DTL_SIFT;
+        mgr.config().reorder_thresh = mgr.node_count() + 2;
+
+        CHECK_THROWS_AS((xs[0] & xs[4]) | (xs[1] & xs[5]) | (xs[2] & xs[6]), std::invalid_argument);
+        CHECK(mgr.decomposition(0) == expansion::S);
+    }
+
+    SECTION("Growth beyond the threshold triggers reordering")
+    {
+        mgr.config().dyn_reorder = reorder_method::SIFT;
+        mgr.config().reorder_thresh = mgr.node_count() + 2;
+        auto const g = (xs[0] & xs[4]) | (xs[1] & xs[5]) | (xs[2] & xs[6]) | (xs[3] & xs[7]);
+
+        CHECK(mgr.dyn_reorder_count() > 0);
+        CHECK(g.eval({true, false, false, false, true, false, false, false}));
+        CHECK_FALSE(g.eval({true, true, true, true, false, false, false, false}));
+        CHECK(f.eval({false, false, true, true, false, false, false, false}));
+    }
 }
 
 TEST_CASE("BDD can be cleaned up", "[basic]")
@@ -218,3 +406,472 @@ TEST_CASE("BDD solves #SAT", "[basic]")
 
     CHECK(((mgr.var() & mgr.var()) | ~mgr.var()).sharpsat() == 5);
 }
+
+TEST_CASE("BDD can be saved and loaded", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("x0"), x1 = mgr.var("x1"), x2 = mgr.var("x2"), x3 = mgr.var("x3");
+    std::vector<bdd> const fs{(x0 & x1) | (x2 & ~x3), x0 ^ x3, mgr.zero()};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        bdd_manager other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the same DDs")
+    {
+        CHECK(mgr.load(ss) == fs);
+    }
+
+    SECTION("Corrupt files are rejected")
+    {
+        auto str = ss.str();
+        str.pop_back();
+        std::istringstream iss{str};
+        bdd_manager other;
+
+        CHECK_THROWS_AS(other.load(iss), std::runtime_error);
+    }
+
+    SECTION("Huge counts in corrupt files are rejected before allocating")
+    {
+        std::string const huge{"\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x3F"};  // 2^62 - 1 as varint
+        auto const str = ss.str();
+        std::istringstream roots{str.substr(0, str.size() - 7) + huge};  // number of roots, which are 3 of 1 + 1 bytes
+        std::istringstream type{str.substr(0, 8) + huge};               // length of the type name after the header
+        bdd_manager other;
+
+        CHECK_THROWS_AS(other.load(roots), std::runtime_error);
+        CHECK_THROWS_AS(other.load(type), std::runtime_error);
+    }
+
+    SECTION("Corrupt files do not yield non-canonical DDs")
+    {
+        auto const str = ss.str();
+        for (auto i = 0uz; i < str.size(); ++i)
+        {
+            for (auto const mask : {0x01, 0x02, 0x80, 0xFF})
+            {
+                auto corrupt = str;
+                corrupt[i] = static_cast<char>(corrupt[i] ^ mask);
+                std::istringstream iss{corrupt};
+                bdd_manager other;
+                auto const ys = {other.var(), other.var(), other.var(), other.var()};
+                std::vector<bdd> gs;
+                try
+                {
+                    gs = other.load(iss);
+                }
+                catch (std::runtime_error const&)
+                {
+                    continue;
+                }
+                if (other.var_count() != 4)
+                {
+                    continue;
+                }
+
+                for (auto const& g : gs)
+                {  // rebuilt by operations from its truth table
+                    auto h = other.zero();
+                    for (auto a = 0u; a < 16; ++a)
+                    {
+                        std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+                        auto m = other.one();
+                        for (auto j = 0uz; auto const& y : ys)
+                        {
+                            m &= as[j++] ? y : ~y;
+                        }
+                        h |= g.eval(as) ? m : other.zero();
+                    }
+
+                    CHECK(g == h);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("BDD can be transferred", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("a"), x1 = mgr.var("b"), x2 = mgr.var("c"), x3 = mgr.var("d");
+    std::vector<bdd> const fs{(x0 & x1) | (x2 & ~x3), x0 ^ x3, ~x1, mgr.one()};
+    auto equal = [&fs](auto const& gs, auto const& as_of) {
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+                if (fs[i].eval(as) != (gs[i].eval(as_of(as)) == 1))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    auto const same = [](std::vector<bool> const& as) { return as; };
+
+    SECTION("Another order is established by the destination")
+    {
+        bdd_manager other;
+        for (auto i = 0; i < 4; ++i)
+        {
+            other.var();
+        }
+        other.permute(std::vector<var_index>{3, 1, 0, 2});
+        auto const gs = mgr.transfer(fs, other);
+
+        CHECK(equal(gs, same));
+        CHECK(other.transfer(gs, mgr) == fs);
+    }
+
+    SECTION("Variables can be mapped by label")
+    {
+        bdd_manager other;
+        other.var("d");
+        other.var("c");
+        other.var("b");
+        other.var("a");
+        auto const gs = mgr.transfer(fs, other, var_mapping::LABEL);
+
+        CHECK(equal(gs, [](std::vector<bool> const& as) { return std::vector<bool>{as[3], as[2], as[1], as[0]}; }));
+
+        bdd_manager few;
+        few.var("a");
+
+        CHECK_THROWS_AS(mgr.transfer(fs, few), std::invalid_argument);
+        CHECK_THROWS_AS(mgr.transfer(fs, few, var_mapping::LABEL), std::invalid_argument);
+    }
+
+    SECTION("Other DD types are supported")
+    {
+        kfdd_manager kfdd_mgr;
+        kfdd_mgr.var(expansion::pD);
+        kfdd_mgr.var(expansion::nD);
+        kfdd_mgr.var();
+        kfdd_mgr.var(expansion::pD);
+        bmd_manager bmd_mgr;
+        for (auto i = 0; i < 4; ++i)
+        {
+            bmd_mgr.var();
+        }
+
+        auto const gs = mgr.transfer(fs, kfdd_mgr);
+        auto const hs = mgr.transfer(fs, bmd_mgr);
+
+        CHECK(equal(gs, same));
+        CHECK(equal(hs, same));
+        CHECK(kfdd_mgr.transfer(gs, mgr) == fs);
+    }
+}
+
+TEST_CASE("BDD evaluates assignments in batches", "[basic]")
+{
+    bdd_manager mgr;
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var();
+    std::vector<bdd> const fs{(x0 & x1) | ~x2, x0 ^ x1 ^ x2, mgr.one()};
+    std::vector<std::vector<std::uint64_t>> const as{{0xAAAA'AAAA'AAAA'AAAA, 0x0123'4567'89AB'CDEF},
+                                                     {0xCCCC'CCCC'CCCC'CCCC, 0xFEDC'BA98'7654'3210},
+                                                     {0xF0F0'F0F0'F0F0'F0F0, 0xDEAD'BEEF'DEAD'BEEF}};
+
+    auto const res = mgr.eval_batch(fs, as);
+
+    REQUIRE(res.size() == fs.size());
+    for (auto i = 0uz; i < fs.size(); ++i)
+    {
+        REQUIRE(res[i].size() == 2);
+        for (auto j = 0uz; j < 128; ++j)
+        {
+            auto bit = [j](std::uint64_t const w) { return ((w >> (j % 64)) & 1u) != 0; };
+
+            CHECK(bit(res[i][j / 64]) == fs[i].eval({bit(as[0][j / 64]), bit(as[1][j / 64]), bit(as[2][j / 64])}));
+        }
+    }
+}
+
+TEST_CASE("BDD can be compiled", "[basic]")
+{
+    bdd_manager mgr;
+    std::vector<bdd> xs;
+    for (auto i = 0; i < 70; ++i)
+    {  // assignments span two words
+        xs.push_back(mgr.var());
+    }
+    auto const f = (xs[0] & ~xs[65]) ^ (xs[3] | xs[69]) ^ ~xs[40];
+
+    auto const c = mgr.compile(f);
+
+    CHECK(c.var_count() == 70);
+    CHECK(c.words() == 2);
+    CHECK(c.node_count() == f.size());
+    for (auto const m : {0u, 1u, 2u, 5u, 9u, 18u, 31u})
+    {
+        std::vector<bool> as(70);
+        as[0] = (m & 1u) != 0;
+        as[3] = (m & 2u) != 0;
+        as[40] = (m & 4u) != 0;
+        as[65] = (m & 8u) != 0;
+        as[69] = (m & 16u) != 0;
+
+        CHECK(c.eval(compiled_bdd::pack(as)) == f.eval(as));
+    }
+    CHECK_FALSE(mgr.compile(mgr.zero()).eval(std::vector<std::uint64_t>(2)));
+    CHECK(mgr.compile(mgr.one()).eval(std::vector<std::uint64_t>(2)));
+}
+
+TEST_CASE("BDD cubes can be enumerated lazily", "[basic]")
+{
+    bdd_manager mgr;
+    std::vector<bdd> xs;
+    for (auto i = 0; i < 4; ++i)
+    {
+        xs.push_back(mgr.var());
+    }
+    auto const f = (xs[0] & ~xs[1]) | (xs[2] ^ xs[3]);
+
+    auto g = mgr.zero();
+    for (auto const& c : f.cubes())
+    {
+        auto cube = mgr.one();
+        for (auto i = 0uz; i < c.size(); ++i)
+        {
+            if (c[i])
+            {
+                cube &= *c[i] ? xs[i] : ~xs[i];
+            }
+        }
+        CHECK((g & cube) == mgr.zero());  // disjoint
+        g |= cube;
+    }
+    CHECK(g == f);
+
+    auto n = 0;
+    for (auto const& c : f.cubes() | std::views::take(2))
+    {
+        CHECK(c.size() == 4);
+        ++n;
+    }
+    CHECK(n == 2);
+    CHECK(std::ranges::distance(mgr.zero().cubes()) == 0);
+    CHECK(std::ranges::distance(mgr.one().cubes()) == 1);
+}
+
+TEST_CASE("BDD solutions can be sampled uniformly", "[basic]")
+{
+    bdd_manager mgr;
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var();
+    auto const f = ~x0 | (x1 & ~x2);  // 5 solutions
+    std::mt19937_64 rng{42};
+
+    auto const as = f.sample(rng, 50'000);
+
+    CHECK(std::ranges::all_of(as, [&f](auto const& a) { return f.eval(a); }));
+    std::array<int, 8> hist{};
+    for (auto const& a : as)
+    {
+        ++hist[(a[0] ? 1 : 0) + (a[1] ? 2 : 0) + (a[2] ? 4 : 0)];
+    }
+    for (auto const n : hist)
+    {
+        CHECK((n == 0 || (n > 9'500 && n < 10'500)));
+    }
+
+    auto const smp = mgr.sampler(f);
+    auto const bs = smp.sample_parallel(10'000, 7);
+
+    CHECK(bs == smp.sample_parallel(10'000, 7));
+    CHECK(std::ranges::all_of(bs, [&f](auto const& b) { return f.eval(b); }));
+    CHECK(mgr.sampler(mgr.one()).sample(rng).size() == 3);
+    CHECK_THROWS_AS(mgr.sampler(mgr.zero()), std::invalid_argument);
+}
+
+TEST_CASE("BDD solutions of sparse functions can be sampled uniformly", "[basic]")
+{
+    bdd_manager mgr;
+    std::vector<bdd> xs(80);
+    for (auto& x : xs)
+    {
+        x = mgr.var();
+    }
+    auto all1 = mgr.one(), all0 = mgr.one();
+    for (auto i = 0; i < 60; ++i)
+    {
+        all1 &= xs[i];
+        all0 &= ~xs[i];
+    }
+    auto const f = (all1 | all0) & ~xs[79];  // 2^20 solutions, i.e., a density of 2^-60
+    std::mt19937_64 rng{42};
+
+    auto const as = f.sample(rng, 1'000);
+
+    CHECK(std::ranges::all_of(as, [&f](auto const& a) { return f.eval(a); }));
+    auto const n = std::ranges::count_if(as, [](auto const& a) { return a[0]; });
+    CHECK(n > 400);
+    CHECK(n < 600);
+}
+
+TEST_CASE("BDD minimum-cost assignment is found", "[basic]")
+{
+    bdd_manager mgr;
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var(), x3 = mgr.var();
+    auto const f = (x0 | ~x1) & (x1 ^ x3);  // x2 does not occur
+    std::vector<std::pair<double, double>> const costs{{0, 2}, {5, 1}, {3, 1}, {0, 4}};
+
+    auto const [cost, as] = f.min_cost_assignment(costs);
+
+    auto min = std::numeric_limits<double>::infinity();
+    for (auto m = 0u; m < 16; ++m)
+    {
+        std::vector<bool> bs(4);
+        auto c = 0.0;
+        for (auto x = 0u; x < 4; ++x)
+        {
+            bs[x] = ((m >> x) & 1u) != 0;
+            c += bs[x] ? costs[x].second : costs[x].first;
+        }
+        if (f.eval(bs))
+        {
+            min = std::min(min, c);
+        }
+    }
+    CHECK(cost == min);
+    CHECK(f.eval(as));
+    CHECK(as[2]);
+    CHECK_THROWS_AS(f.min_cost_assignment({}), std::invalid_argument);
+    CHECK_THROWS_AS(mgr.zero().min_cost_assignment(costs), std::invalid_argument);
+}
+
+TEST_CASE("BDD ISOP cover is computed", "[basic]")
+{
+    bdd_manager mgr;
+    std::vector<bdd> xs;
+    for (auto i = 0; i < 5; ++i)
+    {
+        xs.push_back(mgr.var());
+    }
+    auto const f = (xs[0] & xs[1]) | (~xs[1] & xs[2] & ~xs[4]) | (xs[3] ^ xs[0]);
+    auto prod = [&mgr, &xs](isop_cover::cube const& c) {
+        auto p = mgr.one();
+        for (auto i = 0uz; i < c.size(); ++i)
+        {
+            if (c[i])
+            {
+                p &= *c[i] ? xs[i] : ~xs[i];
+            }
+        }
+        return p;
+    };
+
+    auto const cover = f.isop();
+    auto const cs = cover.cubes();
+
+    CHECK(cover.cube_count() == static_cast<double>(cs.size()));
+    auto g = mgr.zero();
+    for (auto const& c : cs)
+    {
+        g |= prod(c);
+    }
+    CHECK(g == f);
+    for (auto i = 0uz; i < cs.size(); ++i)
+    {  // irredundant and prime
+        auto rest = mgr.zero();
+        for (auto j = 0uz; j < cs.size(); ++j)
+        {
+            rest |= i == j ? mgr.zero() : prod(cs[j]);
+        }
+        CHECK((prod(cs[i]) & ~rest) != mgr.zero());
+        for (auto x = 0uz; x < cs[i].size(); ++x)
+        {
+            if (cs[i][x])
+            {
+                auto c = cs[i];
+                c[x].reset();
+                CHECK((prod(c) & ~f) != mgr.zero());
+            }
+        }
+    }
+
+    auto const lower = xs[0] & xs[1] & xs[2];
+    auto const upper = xs[0] | xs[1];
+    auto const [h, dc_cover] = mgr.isop(lower, upper);
+
+    CHECK((lower & ~h) == mgr.zero());
+    CHECK((h & ~upper) == mgr.zero());
+    CHECK(dc_cover.cube_count() == 1);
+    CHECK(mgr.zero().isop().cube_count() == 0);
+    CHECK(mgr.one().isop().cubes() == std::vector<isop_cover::cube>{isop_cover::cube(5)});
+    CHECK_THROWS_AS(mgr.isop(upper, lower), std::invalid_argument);
+}
+
+TEST_CASE("BDD can be exported", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 3}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var();
+    std::vector<bdd> const fs{(x0 & x1) | x2, ~x2};
+
+    SECTION("Graphviz nodes are emitted once")
+    {
+        std::ostringstream oss;
+        mgr.dump_dot(fs, {}, oss);
+        auto const dot = oss.str();
+
+        CHECK(dot.starts_with("digraph DD {\n"));
+        CHECK(dot.ends_with("}\n"));
+        CHECK(std::ranges::count(dot, '\n') == 31);  // 3 (header) + 7 (levels) + 6 (roots) + 12 (nodes) + 2 (leaf) + 1
+    }
+
+    SECTION("Edge lists are levelized")
+    {
+        std::ostringstream oss;
+        mgr.dump_edge_list(fs, oss);
+
+        CHECK(oss.str() == "c 0 0\n"
+                           "n 1 2 0 1 0 0\n"
+                           "n 2 1 0 1 1 0\n"
+                           "n 3 0 2 0 1 0\n"
+                           "r 3 0\n"
+                           "r 1 1\n");
+    }
+}
+
+TEST_CASE("BDD operands are combined n-ary", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 6, .heap_mem_limit = 40'511}};
+    std::vector<bdd> xs(6);
+    std::ranges::generate(xs, [&mgr]() { return mgr.var(); });
+    std::vector<bdd> const fs{xs[0] | ~xs[3], xs[1] ^ xs[4], ~(xs[2] & xs[5]), xs[0] | xs[1] | xs[2], xs[5]};
+
+    auto conj = mgr.one();
+    auto disj = mgr.zero();
+    for (auto const& f : fs)
+    {
+        conj &= f;
+        disj |= f;
+    }
+
+    CHECK(mgr.conj_all(fs) == conj);
+    CHECK(mgr.disj_all(fs) == disj);
+    CHECK(mgr.conj_all({}) == mgr.one());
+    CHECK(mgr.disj_all({}) == mgr.zero());
+    CHECK(mgr.conj_all(std::vector{xs[0], ~xs[0], xs[1]}) == mgr.zero());
+    CHECK(mgr.disj_all(std::vector{xs[0], ~xs[0], xs[1]}) == mgr.one());
+}
@@ -0,0 +1,125 @@
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include <catch2/catch_test_macros.hpp>  // TEST_CASE
+
+#include <freddy/dd/bdd.hpp>         // bdd_manager
+#include <freddy/dd/frozen_bdd.hpp>  // frozen_bdd_image
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint32_t
+#include <cstring>     // std::memcpy
+#include <filesystem>  // std::filesystem::temp_directory_path
+#include <fstream>     // std::ofstream
+#include <iterator>    // std::istreambuf_iterator
+#include <optional>    // std::optional
+#include <stdexcept>   // std::runtime_error
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+using namespace freddy;
+
+// *********************************************************************************************************************
+// Macros
+// *********************************************************************************************************************
+
+TEST_CASE("BDD can be frozen", "[basic]")
+{
+    bdd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var(), x3 = mgr.var();
+    std::vector<bdd> const fs{(x0 & x1) | (x2 & ~x3), ~(x0 ^ x3), mgr.zero(), mgr.one()};
+    mgr.swap(0, 2);
+    auto const path = std::filesystem::temp_directory_path() / "freddy_frozen_bdd.img";
+    {
+        std::ofstream ofs{path, std::ios::binary};
+        mgr.freeze(fs, ofs);
+    }
+    frozen_bdd_image const img{path};
+
+    REQUIRE(img.size() == fs.size());
+    CHECK(img.var_count() == mgr.var_count());
+    CHECK(img.node_count() == mgr.size(fs));
+
+    SECTION("Evaluation and #SAT match the original BDDs")
+    {
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(img[i].eval(as) == fs[i].eval(as));
+            }
+            CHECK(img[i].sharpsat() == fs[i].sharpsat());
+        }
+    }
+
+    SECTION("Cofactors can be walked")
+    {
+        auto const f = img[0];
+
+        CHECK(f.var() == fs[0].var());
+        CHECK(f.high().is_complemented() == fs[0].high().is_complemented());
+        CHECK(f.low().is_complemented() == fs[0].low().is_complemented());
+        CHECK(img[2].is_zero());
+        CHECK(img[3].is_one());
+    }
+
+    SECTION("Satisfying assignments are enumerated")
+    {
+        auto count = 0.0;
+        img[0].for_each_sat([&](std::vector<std::optional<bool>> const& cube) {
+            std::vector<bool> as(cube.size());
+            auto dcs = 0;
+            for (auto x = 0uz; x < cube.size(); ++x)
+            {
+                as[x] = cube[x].value_or(false);
+                dcs += cube[x] ? 0 : 1;
+            }
+            count += static_cast<double>(1uz << dcs);
+
+            CHECK(fs[0].eval(as));
+        });
+
+        CHECK(count == fs[0].sharpsat());
+    }
+
+    SECTION("Invalid images are rejected")
+    {
+        auto const invalid = std::filesystem::temp_directory_path() / "freddy_invalid.img";
+        {
+            std::ofstream ofs{invalid, std::ios::binary};
+            ofs << "no BDD";
+        }
+
+        CHECK_THROWS_AS(frozen_bdd_image{invalid}, std::runtime_error);
+    }
+
+    SECTION("Images with corrupt nodes are rejected")
+    {
+        std::string str;
+        {
+            std::ifstream ifs{path, std::ios::binary};
+            str.assign(std::istreambuf_iterator<char>{ifs}, {});
+        }
+        auto const corrupt = std::filesystem::temp_directory_path() / "freddy_corrupt.img";
+        for (auto const field : {0uz, 1uz})  // variable and high edge of the last node
+        {
+            auto img_str = str;
+            auto const pos = img_str.size() - sizeof(detail::frozen_node) + field * sizeof(std::uint32_t);
+            std::uint32_t const garbage = 0x7FFF'FFFF;
+            std::memcpy(img_str.data() + pos, &garbage, sizeof(garbage));
+            {
+                std::ofstream ofs{corrupt, std::ios::binary};
+                ofs << img_str;
+            }
+
+            CHECK_THROWS_AS(frozen_bdd_image{corrupt}, std::runtime_error);
+        }
+    }
+}
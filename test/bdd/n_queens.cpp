@@ -115,3 +115,17 @@ TEST_CASE("N-Queens solutions are counted", "[example]")
 
     CHECK(queens(n, mgr).sharpsat() == expected);
 }
+
+TEST_CASE("N-Queens solutions are counted with dynamic reordering", "[example]")
+{
+    auto const [n, expected] = GENERATE(std::pair{4, 2}, std::pair{5, 10}, std::pair{6, 4});
+
+    bdd_manager mgr{{.utable_size_hint = 25,
+                     .cache_size_hint = 3'359,
+                     .init_var_cap = static_cast<var_index>(n * n),
+                     .dyn_reorder = reorder_method::SIFT,
+                     .reorder_thresh = 64}};  // to trigger reordering even for n = 4
+
+    CHECK(queens(n, mgr).sharpsat() == expected);
+    CHECK(mgr.dyn_reorder_count() > 0);
+}
@@ -0,0 +1,210 @@
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include <catch2/catch_test_macros.hpp>  // TEST_CASE
+
+#include <freddy/dd/bdd.hpp>   // bdd_manager
+#include <freddy/netlist.hpp>  // read_aiger
+
+#include <cstddef>    // std::size_t
+#include <sstream>    // std::istringstream
+#include <stdexcept>  // std::runtime_error
+#include <string>     // std::string
+#include <utility>    // std::pair
+#include <vector>     // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+using namespace freddy;
+
+namespace
+{
+
+// =====================================================================================================================
+// Functions
+// =====================================================================================================================
+
+auto adder(std::size_t const n)
+{  // ripple-carry adder as BLIF with inputs a0, ..., an-1, b0, ..., bn-1 (LSB first)
+    std::string blif{".model adder\n.inputs"};
+    for (auto const x : {'a', 'b'})
+    {
+        for (auto i = 0uz; i < n; ++i)
+        {
+            blif += " " + std::string{x} + std::to_string(i);
+        }
+    }
+    blif += "\n.outputs";
+    for (auto i = 0uz; i <= n; ++i)
+    {
+        blif += " s" + std::to_string(i);
+    }
+    blif += "\n.names c0\n";  // constant 0
+    for (auto i = 0uz; i < n; ++i)
+    {
+        auto const a = "a" + std::to_string(i), b = "b" + std::to_string(i), c = "c" + std::to_string(i);
+        blif += ".names " + a + " " + b + " " + c + " s" + std::to_string(i) + "\n100 1\n010 1\n001 1\n111 1\n";
+        blif += ".names " + a + " " + b + " " + c + " c" + std::to_string(i + 1) + "\n11- 1\n1-1 1\n-11 1\n";
+    }
+    blif += ".names c" + std::to_string(n) + " s" + std::to_string(n) + "\n1 1\n.end\n";
+    return blif;
+}
+
+auto read(std::string const& str, bool const blif = false)
+{
+    std::istringstream iss{str};
+    return blif ? read_blif(iss) : read_aiger(iss);
+}
+
+}  // namespace
+
+// =====================================================================================================================
+// Tests
+// =====================================================================================================================
+
+TEST_CASE("AIGER can be read", "[basic]")
+{
+    bdd_manager mgr;
+    auto const a = mgr.var();
+    auto const b = mgr.var();
+
+    SECTION("ASCII")
+    {
+        auto const nl = read("aag 3 2 0 2 1\n2\n4\n6\n7\n6 2 5\ni0 a\ni1 b\no0 f\nc\ncomment\n");
+
+        CHECK(nl.inputs == 2);
+        CHECK(nl.input_names == std::vector<std::string>{"a", "b"});
+        CHECK(nl.output_names == std::vector<std::string>{"f", "o1"});
+
+        auto const fs = simulate(mgr, nl, {a, b});
+
+        CHECK(fs.size() == 2);
+        CHECK(fs[0] == (a & ~b));
+        CHECK(fs[1] == ~(a & ~b));
+    }
+
+    SECTION("binary")
+    {
+        auto const nl = read("aig 3 2 0 2 1\n6\n7\n\x01\x03");
+
+        auto const fs = simulate(mgr, nl, {a, b});
+
+        CHECK(fs[0] == (a & ~b));
+        CHECK(fs[1] == ~(a & ~b));
+    }
+
+    SECTION("latches and constants")
+    {
+        auto const nl = read("aag 2 1 1 2 0\n2\n4 3\n0\n4\n");  // the latch stores the negated input
+
+        CHECK(nl.inputs == 2);  // the latch output is cut
+        CHECK(nl.outputs.size() == 3);
+
+        auto const fs = simulate(mgr, nl, {a, b});
+
+        CHECK(fs[0] == mgr.zero());
+        CHECK(fs[1] == b);
+        CHECK(fs[2] == ~a);  // next state
+    }
+
+    SECTION("invalid files")
+    {
+        CHECK_THROWS_AS(read("aag 1 1 0 1 0 1\n2\n2\n"), std::runtime_error);  // bad state property
+        CHECK_THROWS_AS(read("aag 2 1 0 1 1\n2\n4\n4 2 6\n"), std::runtime_error);  // undefined literal
+        CHECK_THROWS_AS(read("aag 3 1 0 1 2\n2\n4\n4 2 6\n6 2 4\n"), std::runtime_error);  // cycle
+        CHECK_THROWS_AS(read("aag 1 1 0 0 0\n4\n"), std::runtime_error);  // input beyond M
+        CHECK_THROWS_AS(read("aag 1 0 1 0 0\n4 0\n"), std::runtime_error);  // latch beyond M
+        CHECK_THROWS_AS(read("aag 1 1 0 1 0\n2\n2\nix b\n"), std::runtime_error);  // symbol without index
+        CHECK_THROWS_AS(read("aag 1 1 0 1 0\n2\n2\ni99999999999999999999 b\n"), std::runtime_error);
+    }
+}
+
+TEST_CASE("BLIF can be read", "[basic]")
+{
+    bdd_manager mgr;
+    auto const a = mgr.var();
+    auto const b = mgr.var();
+    auto const c = mgr.var();
+
+    SECTION("covers")
+    {
+        auto const nl = read(".model fa  # full adder\n.inputs a b \\\n cin\n.outputs s cout one nor\n"
+                             ".names t cin s\n10 1\n01 1\n.names a b t\n10 1\n01 1\n"
+                             ".names a b cin cout\n11- 1\n1-1 1\n-11 1\n.names one\n1\n"
+                             ".names a b nor\n1- 0\n-1 0\n.end\n",
+                             true);
+
+        CHECK(nl.inputs == 3);
+        CHECK(nl.gates.size() == 5);
+        CHECK(nl.input_names == std::vector<std::string>{"a", "b", "cin"});
+
+        auto const fs = simulate(mgr, nl, {a, b, c});
+
+        CHECK(fs[0] == (a ^ b ^ c));
+        CHECK(fs[1] == ((a & b) | (a & c) | (b & c)));
+        CHECK(fs[2] == mgr.one());
+        CHECK(fs[3] == ~(a | b));
+    }
+
+    SECTION("latches")
+    {
+        auto const nl = read(".inputs x\n.outputs y\n.latch n q 0\n.names x q n\n11 1\n.names q y\n0 1\n", true);
+
+        CHECK(nl.input_names == std::vector<std::string>{"x", "q"});
+        CHECK(nl.output_names == std::vector<std::string>{"y", "n"});
+
+        auto const fs = simulate(mgr, nl, {a, b});
+
+        CHECK(fs[0] == ~b);
+        CHECK(fs[1] == (a & b));
+    }
+
+    SECTION("invalid files")
+    {
+        CHECK_THROWS_AS(read(".inputs a\n.outputs y\n.subckt m x=a y=y\n", true), std::runtime_error);
+        CHECK_THROWS_AS(read(".inputs a\n.outputs y\n.names a y\n1 1\n0 0\n", true), std::runtime_error);
+        CHECK_THROWS_AS(read(".inputs a\n.outputs y\n.names a z y\n11 1\n", true), std::runtime_error);
+    }
+}
+
+TEST_CASE("Netlist can be simulated in parallel", "[basic]")
+{
+    auto const n = 8uz;
+    auto const nl = read(adder(n), true);
+
+    bdd_manager mgr;
+    std::vector<bdd> xs;
+    for (auto i = 0uz; i < n; ++i)
+    {  // interleaved order
+        xs.push_back(mgr.var());
+        xs.push_back(mgr.var());
+    }
+    std::vector<bdd> ins(2 * n);
+    for (auto i = 0uz; i < n; ++i)
+    {
+        ins[i] = xs[2 * i];
+        ins[n + i] = xs[(2 * i) + 1];
+    }
+
+    auto const seq = simulate(mgr, nl, ins);
+    auto const par = simulate(mgr, nl, ins, 4);
+
+    CHECK(seq == par);
+    CHECK(mgr.var_count() == 2 * n);
+    for (auto const& [x, y] : {std::pair{0u, 0u}, {255u, 1u}, {170u, 85u}, {200u, 100u}})
+    {
+        std::vector<bool> as(2 * n);
+        for (auto i = 0uz; i < n; ++i)
+        {
+            as[2 * i] = ((x >> i) & 1u) != 0;
+            as[(2 * i) + 1] = ((y >> i) & 1u) != 0;
+        }
+        for (auto i = 0uz; i <= n; ++i)
+        {
+            CHECK(par[i].eval(as) == ((((x + y) >> i) & 1u) != 0));
+        }
+    }
+}
@@ -0,0 +1,188 @@
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include <catch2/catch_test_macros.hpp>  // TEST_CASE
+
+#include <freddy/config.hpp>  // var_index
+#include <freddy/dd/bdd.hpp>  // bdd_manager
+#include <freddy/order.hpp>   // netlist
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint8_t
+#include <utility>  // std::pair
+#include <vector>   // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+using namespace freddy;
+
+namespace
+{
+
+// =====================================================================================================================
+// Types
+// =====================================================================================================================
+
+enum struct gate : std::uint8_t
+{
+    AND,
+    XOR,
+    MAJ  // majority of three
+};
+
+struct circuit
+{
+    netlist nl;
+
+    std::vector<gate> types;  // per gate
+
+    auto add(gate const t, std::vector<std::size_t> fanins)
+    {
+        nl.gates.push_back(std::move(fanins));
+        types.push_back(t);
+        return nl.signal_count() - 1;
+    }
+};
+
+// =====================================================================================================================
+// Functions
+// =====================================================================================================================
+
+auto adder(std::size_t const n)
+{  // ripple-carry adder with inputs a_0, ..., a_n-1, b_0, ..., b_n-1 (LSB first)
+    circuit c;
+    c.nl.inputs = 2 * n;
+    auto carry = c.add(gate::AND, {0, n});
+    c.nl.outputs.push_back(c.add(gate::XOR, {0, n}));
+    for (auto i = 1uz; i < n; ++i)
+    {
+        auto const p = c.add(gate::XOR, {i, n + i});
+        c.nl.outputs.push_back(c.add(gate::XOR, {p, carry}));
+        carry = c.add(gate::MAJ, {i, n + i, carry});
+    }
+    c.nl.outputs.push_back(carry);
+    return c;
+}
+
+auto multiplier(std::size_t const n)
+{  // array multiplier with inputs a_0, ..., a_n-1, b_0, ..., b_n-1 (LSB first)
+    circuit c;
+    c.nl.inputs = 2 * n;
+    std::vector<std::size_t> acc;  // partial sum of the current row
+    for (auto j = 0uz; j < n; ++j)
+    {
+        acc.push_back(c.add(gate::AND, {j, n}));
+    }
+    c.nl.outputs.push_back(acc.front());
+    for (auto i = 1uz; i < n; ++i)
+    {
+        std::vector<std::size_t> next;
+        std::size_t carry{};
+        for (auto j = 0uz; j < n; ++j)
+        {
+            auto const pp = c.add(gate::AND, {j, n + i});
+            auto const in = j + 1 < n ? acc[j + 1] : carry;  // top bit of the previous row is its final carry
+            if (j == 0)
+            {
+                next.push_back(c.add(gate::XOR, {pp, in}));
+                carry = c.add(gate::AND, {pp, in});
+                continue;
+            }
+            auto const p = c.add(gate::XOR, {pp, in});
+            next.push_back(c.add(gate::XOR, {p, carry}));
+            carry = c.add(gate::MAJ, {pp, in, carry});
+        }
+        next.push_back(carry);
+        c.nl.outputs.push_back(next.front());
+        acc.assign(next.begin() + 1, next.end());
+    }
+    c.nl.outputs.insert(c.nl.outputs.end(), acc.begin(), acc.end());
+    return c;
+}
+
+auto build(circuit const& c, std::vector<var_index> const& order, bdd_manager& mgr)
+{  // variables are created in the given order
+    std::vector<bdd> signals(c.nl.signal_count());
+    for (auto const s : order)
+    {
+        signals[s] = mgr.var();
+    }
+    for (auto i = 0uz; i < c.nl.gates.size(); ++i)
+    {
+        auto const& fs = c.nl.gates[i];
+        auto& g = signals[c.nl.inputs + i];
+        switch (c.types[i])
+        {
+            case gate::AND: g = signals[fs[0]] & signals[fs[1]]; break;
+            case gate::XOR: g = signals[fs[0]] ^ signals[fs[1]]; break;
+            case gate::MAJ:
+                g = (signals[fs[0]] & signals[fs[1]]) | (signals[fs[2]] & (signals[fs[0]] ^ signals[fs[1]]));
+                break;
+        }
+    }
+
+    std::vector<bdd> outputs;
+    for (auto const s : c.nl.outputs)
+    {
+        outputs.push_back(signals[s]);
+    }
+    return std::pair{mgr.size(outputs), outputs};
+}
+
+auto natural(std::size_t const n)
+{  // a_0, ..., a_n-1, b_0, ..., b_n-1
+    std::vector<var_index> order(2 * n);
+    for (auto i = 0uz; i < order.size(); ++i)
+    {
+        order[i] = static_cast<var_index>(i);
+    }
+    return order;
+}
+
+auto operands(std::size_t const n)
+{
+    std::vector<std::vector<var_index>> words(2);
+    for (auto i = 0uz; i < n; ++i)
+    {
+        words[0].push_back(static_cast<var_index>(i));
+        words[1].push_back(static_cast<var_index>(n + i));
+    }
+    return words;
+}
+
+}  // namespace
+
+// *********************************************************************************************************************
+// Macros
+// *********************************************************************************************************************
+
+TEST_CASE("adder is built in a static variable order", "[example]")
+{
+    auto const c = adder(12);
+    bdd_manager mgr0, mgr1, mgr2, mgr3;
+    auto const [natural_size, fs] = build(c, natural(12), mgr0);
+    auto const [dfs_size, gs] = build(c, dfs_order(c.nl), mgr1);
+    auto const [force_size, hs] = build(c, force_order(c.nl), mgr2);
+    auto const [interleaved_size, is] = build(c, interleave(operands(12)), mgr3);
+
+    CHECK(dfs_size < natural_size / 10);
+    CHECK(force_size < natural_size / 10);
+    CHECK(interleaved_size < natural_size / 10);
+    CHECK(fs[12].sharpsat() == gs[12].sharpsat());
+    CHECK(hs[7].eval(std::vector<bool>(24, true)) == is[7].eval(std::vector<bool>(24, true)));
+}
+
+TEST_CASE("multiplier is built in a static variable order", "[example]")
+{
+    auto const c = multiplier(6);
+    bdd_manager mgr0, mgr1;
+    auto const [natural_size, fs] = build(c, natural(6), mgr0);
+    auto const [dfs_size, gs] = build(c, dfs_order(c.nl), mgr1);
+
+    CHECK(fs.size() == 12);
+    CHECK(fs[11].sharpsat() == gs[11].sharpsat());
+    CHECK(dfs_size > 0);
+}
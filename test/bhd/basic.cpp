@@ -7,9 +7,10 @@
 #include <freddy/config.hpp>  // var_index
 #include <freddy/dd/bhd.hpp>  // bhd_manager
 
-#include <sstream>  // std::ostringstream
-#include <utility>  // std::pair
-#include <vector>   // std::vector
+#include <optional>  // std::optional
+#include <sstream>   // std::ostringstream
+#include <utility>   // std::pair
+#include <vector>    // std::vector
 
 // *********************************************************************************************************************
 // Namespaces
@@ -244,6 +245,19 @@ TEST_CASE("BHD SAT can be utilized", "[basic]")
         CHECK(sols[1] == std::vector{true, true, true});
     }
 
+    SECTION("Cubes are enumerated lazily")
+    {
+        std::vector<std::vector<std::optional<bool>>> cubes;
+        for (auto const& c : f.cubes())
+        {
+            cubes.push_back(c);
+        }
+
+        REQUIRE(cubes.size() == 2);
+        CHECK(cubes[0] == std::vector<std::optional<bool>>{false, true, true});
+        CHECK(cubes[1] == std::vector<std::optional<bool>>{true, true, std::nullopt});
+    }
+
     SECTION("Unit clauses are generated")
     {
         auto const ucs = f.unit_clauses();
@@ -280,3 +294,37 @@ TEST_CASE("BHD heuristics restrict solution spaces", "[basic]")
         CHECK_FALSE(f.eval(std::vector(mgr.var_count(), true)).has_value());
     }
 }
+
+TEST_CASE("BHD can be saved and loaded", "[basic]")
+{
+    bhd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("x0"), x1 = mgr.var("x1"), x2 = mgr.var("x2"), x3 = mgr.var("x3");
+    std::vector<bhd> const fs{(x0 & x1) | (x2 & x3) | mgr.exp(), x0 ^ x3};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        bhd_manager other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the same DDs")
+    {
+        CHECK(mgr.load(ss) == fs);
+    }
+}
@@ -7,6 +7,7 @@
 #include <freddy/config.hpp>  // config
 #include <freddy/dd/bmd.hpp>  // bmd_manager
 
+#include <cstdint>       // std::uint64_t
 #include <limits>        // std::numeric_limits
 #include <sstream>       // std::ostringstream
 #include <system_error>  // std::system_error
@@ -215,6 +216,32 @@ TEST_CASE("BMD variable order is changeable", "[basic]")
         CHECK(f.eval({false, true, false, false, true, false}) == 1);
         CHECK(f.eval({false, false, true, false, false, true}) == 1);
     }
+
+    SECTION("Exact reordering is not worse than other methods")
+    {
+        mgr.reorder(reorder_method::WINDOW2);
+        auto const window_size = f.size();
+        mgr.reorder(reorder_method::EXACT);
+
+        CHECK(window_size >= f.size());
+        CHECK(f.eval({true, true, true, false, false, false}) == 0);
+        CHECK(f.eval({true, false, false, true, false, false}) == 1);
+        CHECK(f.eval({false, true, false, false, true, false}) == 1);
+        CHECK(f.eval({false, false, true, false, false, true}) == 1);
+    }
+
+    SECTION("Parallel reordering adopts the best candidate")
+    {
+        mgr.reorder(reorder_method::EXACT);
+        auto const exact_size = f.size();
+        mgr.permute(std::vector<var_index>{0, 1, 2, 3, 4, 5});
+        mgr.reorder_parallel({reorder_method::SIFT, reorder_method::EXACT});
+
+        CHECK(exact_size == f.size());
+        CHECK(f.eval({true, true, true, false, false, false}) == 0);
+        CHECK(f.eval({true, false, false, true, false, false}) == 1);
+        CHECK(f.eval({false, false, true, false, false, true}) == 1);
+    }
 }
 
 TEST_CASE("BMD can be cleaned up", "[basic]")
@@ -273,3 +300,111 @@ TEST_CASE("BMD interprets bits numerically", "[basic]")
         CHECK(mgr.twos_complement(ha) == a + b - mgr.constant(4) * a * b);
     }
 }
+
+TEST_CASE("BMD can be saved and loaded", "[basic]")
+{
+    bmd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("x0"), x1 = mgr.var("x1"), x2 = mgr.var("x2"), x3 = mgr.var("x3");
+    std::vector<bmd> const fs{x0 * x1 - mgr.constant(3) * x2 + x3, (x0 & x1) | (x2 & x3)};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        bmd_manager other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the same DDs")
+    {
+        CHECK(mgr.load(ss) == fs);
+    }
+}
+
+TEST_CASE("BMD can be transferred", "[basic]")
+{
+    bmd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var("x0"), x1 = mgr.var("x1"), x2 = mgr.var("x2"), x3 = mgr.var("x3");
+    std::vector<bmd> const fs{x0 * x1 - mgr.constant(3) * x2 + x3, (x0 & x1) | (x2 & x3), mgr.constant(-5)};
+    bmd_manager other;
+    for (auto i = 0; i < 4; ++i)
+    {
+        other.var();
+    }
+    other.permute(std::vector<var_index>{2, 0, 3, 1});
+
+    auto const gs = mgr.transfer(fs, other);
+
+    REQUIRE(gs.size() == fs.size());
+    for (auto i = 0uz; i < fs.size(); ++i)
+    {
+        for (auto a = 0u; a < 16; ++a)
+        {
+            std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+            CHECK(fs[i].eval(as) == gs[i].eval(as));
+        }
+    }
+    CHECK(other.transfer(gs, mgr) == fs);
+}
+
+TEST_CASE("BMD evaluates assignments in batches", "[basic]")
+{
+    bmd_manager mgr;
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var();
+    std::vector<bmd> const fs{x0 * x1 - mgr.constant(3) * x2 + mgr.constant(7), mgr.unsigned_bin({x0, x1, x2})};
+    std::vector<std::vector<std::uint64_t>> const as{
+        {0xAAAA'AAAA'AAAA'AAAA}, {0xCCCC'CCCC'CCCC'CCCC}, {0xF0F0'F0F0'F0F0'F0F0}};
+
+    auto const res = mgr.eval_batch(fs, as);
+
+    REQUIRE(res.size() == fs.size());
+    for (auto i = 0uz; i < fs.size(); ++i)
+    {
+        REQUIRE(res[i].size() == 64);
+        for (auto j = 0uz; j < 64; ++j)
+        {
+            CHECK(res[i][j] == fs[i].eval({(j & 1) != 0, (j & 2) != 0, (j & 4) != 0}));
+        }
+    }
+}
+
+TEST_CASE("BMD operands are combined n-ary", "[basic]")
+{
+    bmd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 4}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var(), x3 = mgr.var();
+    std::vector<bmd> const fs{x0 * x1 + mgr.two(), x2 - x3, mgr.constant(3) * x1, x0 + x3};
+
+    CHECK(mgr.sum_all(fs) == ((fs[0] + fs[1]) + fs[2]) + fs[3]);
+    CHECK(mgr.product_all(fs) == ((fs[0] * fs[1]) * fs[2]) * fs[3]);
+    CHECK(mgr.sum_all({}) == mgr.zero());
+    CHECK(mgr.product_all({}) == mgr.one());
+    CHECK(mgr.product_all(std::vector{x0, mgr.zero(), x1}) == mgr.zero());
+}
+
+TEST_CASE("BMD multiplexes words", "[basic]")
+{
+    bmd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 5}};
+    auto const x0 = mgr.var(), x1 = mgr.var(), x2 = mgr.var(), x3 = mgr.var(), x4 = mgr.var();
+    auto const sel = x0 | (x1 & ~x4);
+    auto const g = mgr.unsigned_bin({x1, x2, x3}), h = mgr.twos_complement({x3, x4, x0});
+
+    CHECK(sel.ite(g, h) == h + sel * (g - h));
+    CHECK(sel.ite(mgr.two() * g, mgr.two() * h) == mgr.two() * sel.ite(g, h));
+    CHECK(sel.ite(mgr.constant(5), mgr.constant(-3)) == mgr.constant(-3) + mgr.constant(8) * sel);
+    CHECK(x2.ite(sel.ite(g, h), g) == g + x2 * (h + sel * (g - h) - g));
+}
@@ -5,10 +5,12 @@
 #include <catch2/catch_test_macros.hpp>  // TEST_CASE
 
 #include <freddy/config.hpp>  // config
-#include <freddy/dd/bmd.hpp>  // bmd_manager
+#include <freddy/dd/bmd.hpp>  // bmd_manager, wide_bmd_manager
 
-#include <array>   // std::array
-#include <vector>  // std::vector
+#include <array>    // std::array
+#include <cstdint>  // UINT64_MAX
+#include <string>   // std::to_string
+#include <vector>   // std::vector
 
 // *********************************************************************************************************************
 // Namespaces
@@ -58,3 +60,34 @@ TEST_CASE("2-bit multiplier is verified", "[example]")
 
     CHECK(mgr.unsigned_bin(bit_lvl_impl) == word_lvl_spec);
 }
+
+TEST_CASE("64-bit multiplier is verified", "[example]")
+{
+    constexpr auto n = 64uz;
+
+    wide_bmd_manager mgr{{.utable_size_hint = 1'000, .cache_size_hint = 10'000, .init_var_cap = 2 * n}};
+    std::vector<wide_bmd> a, b;
+    for (auto i = 0uz; i < n; ++i)
+    {
+        a.push_back(mgr.var("a" + std::to_string(i)));
+    }
+    for (auto i = 0uz; i < n; ++i)
+    {
+        b.push_back(mgr.var("b" + std::to_string(i)));
+    }
+
+    auto const word_lvl_spec = mgr.unsigned_bin(a) * mgr.unsigned_bin(b);
+
+    // shift-and-add multiplier, whose weights exceed 64 bits
+    auto prod = mgr.zero();
+    for (auto j = 0uz; j < n; ++j)
+    {
+        std::vector<wide_bmd> pp(j, mgr.zero());  // partial product b_j * A * 2^j
+        pp.push_back(b[j]);
+        prod += mgr.unsigned_bin(pp) * mgr.unsigned_bin(a);
+    }
+
+    CHECK(prod == word_lvl_spec);
+    wide_int const max = UINT64_MAX;
+    CHECK(word_lvl_spec.eval(std::vector<bool>(2 * n, true)) == max * max);
+}
@@ -0,0 +1,164 @@
+// *********************************************************************************************************************
+// Includes
+// *********************************************************************************************************************
+
+#include <catch2/catch_test_macros.hpp>  // TEST_CASE
+
+#include <freddy/dd/bmd.hpp>    // wide_bmd_manager
+#include <freddy/wide_int.hpp>  // wide_int
+
+#include <cstdint>     // std::int64_t
+#include <functional>  // std::hash
+#include <random>      // std::mt19937_64
+#include <sstream>     // std::ostringstream
+#include <string>      // std::string
+#include <vector>      // std::vector
+
+// *********************************************************************************************************************
+// Namespaces
+// *********************************************************************************************************************
+
+using namespace freddy;
+
+namespace
+{
+
+// =====================================================================================================================
+// Functions
+// =====================================================================================================================
+
+auto ipow(wide_int const& base, int const exp)
+{
+    wide_int res = 1;
+    for (auto i = 0; i < exp; ++i)
+    {
+        res *= base;
+    }
+    return res;
+}
+
+auto str(wide_int const& n)
+{
+    std::ostringstream oss;
+    oss << n;
+    return oss.str();
+}
+
+}  // namespace
+
+// *********************************************************************************************************************
+// Macros
+// *********************************************************************************************************************
+
+TEST_CASE("wide_int computes like a 128-bit integer", "[basic]")
+{
+    std::mt19937_64 rng{42};
+    for (auto i = 0; i < 10'000; ++i)
+    {
+        auto const a = static_cast<detail::int128>(static_cast<std::int64_t>(rng())) * static_cast<std::int64_t>(rng());
+        auto const b = static_cast<detail::int128>(static_cast<std::int64_t>(rng()));
+        wide_int const wa = a;
+        wide_int const wb = b;
+
+        CHECK(wa + wb == wide_int{a + b});
+        CHECK(wa - wb == wide_int{a - b});
+        CHECK((b == 0 || wa / wb == wide_int{a / b}));
+        CHECK((wa < wb) == (a < b));
+        CHECK(wa * wb / wb == wa);  // mostly beyond 128 bits
+    }
+}
+
+TEST_CASE("wide_int spills beyond 128 bits", "[basic]")
+{
+    auto const max = ipow(2, 127) - 1;
+    auto const min = -max - 1;
+
+    CHECK(max.is_inline());
+    CHECK(min.is_inline());
+    CHECK(str(min) == "-170141183460469231731687303715884105728");
+    CHECK_FALSE((max + 1).is_inline());
+    CHECK_FALSE((-min).is_inline());
+    CHECK_FALSE((min / -1).is_inline());
+    CHECK(min / -1 == max + 1);
+    CHECK(-(-min) == min);
+    CHECK((max + 1 - 1).is_inline());
+    CHECK(max + 1 - 1 == max);
+    CHECK(min - 1 < min);
+    CHECK(max + 1 > max);
+    CHECK(abs(min) == max + 1);
+    CHECK(static_cast<bool>(max + 1));
+    CHECK_FALSE(static_cast<bool>(max + 1 - max - 1));
+}
+
+TEST_CASE("wide_int divides and reduces spilled values", "[basic]")
+{
+    auto const x = ipow(2, 200) + 12'345;
+    auto const y = ipow(3, 90) + 7;  // three limbs
+    auto const r = ipow(2, 100);     // remainder smaller than y
+
+    CHECK_FALSE(x.is_inline());
+    CHECK((x * y + r) / y == x);
+    CHECK((-(x * y) - r) / y == -x);  // truncating
+    CHECK((x * y) / x == y);
+    CHECK(x / (x + 1) == 0);
+    CHECK(str(-ipow(2, 200) / 3) == "-535646014752996758513987364113720867507400997927597611767125");
+
+    auto const g = ipow(3, 90);
+    CHECK(gcd(ipow(2, 130) * g, ipow(5, 60) * g) == g);  // Euclidean algorithm on limbs
+    CHECK(gcd(-ipow(2, 130) * g, ipow(5, 60) * g) == g);
+    CHECK(gcd(x, 0) == x);
+    CHECK(gcd(wide_int{-12}, wide_int{18}) == 6);  // binary GCD
+    CHECK(gcd(wide_int{0}, wide_int{0}) == 0);
+}
+
+TEST_CASE("wide_int is printed and serialized", "[basic]")
+{
+    CHECK(str(0) == "0");
+    CHECK(str(-5) == "-5");
+    CHECK(str(ipow(2, 200)) == "1606938044258990275541962092341162602522202993782792835301376");
+    CHECK(str(ipow(10, 40)) == "1" + std::string(40, '0'));  // zeros within 19-digit chunks
+    CHECK(str(-ipow(10, 19)) == "-1" + std::string(19, '0'));
+
+    std::vector<wide_int> const ns{0, -1, ipow(2, 64), -ipow(2, 127), ipow(2, 127), -ipow(7, 80)};
+    std::stringstream ss;
+    for (auto const& n : ns)
+    {
+        n.write(ss);
+    }
+    for (auto const& n : ns)
+    {
+        auto const m = wide_int::read(ss);
+
+        CHECK(m == n);
+        CHECK(m.is_inline() == n.is_inline());
+        CHECK(std::hash<wide_int>{}(m) == std::hash<wide_int>{}(n));
+    }
+
+    std::istringstream corrupt{"\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x7F\x01"};  // 2^62 - 1 limbs, but only one
+    static_cast<void>(wide_int::read(corrupt));
+
+    CHECK(corrupt.fail());
+}
+
+TEST_CASE("BMD weights beyond 128 bits can be saved and loaded", "[basic]")
+{
+    wide_bmd_manager mgr{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 140}};
+    std::vector<wide_bmd> xs(140);
+    for (auto& x : xs)
+    {
+        x = mgr.var();
+    }
+    auto const f = mgr.unsigned_bin(xs) * mgr.unsigned_bin(xs);
+    std::vector<bool> const as(xs.size(), true);
+
+    CHECK(f.eval(as) == ipow(ipow(2, 140) - 1, 2));
+
+    std::stringstream ss;
+    mgr.save({f}, ss);
+    wide_bmd_manager mgr2{{.utable_size_hint = 25, .cache_size_hint = 3'359, .init_var_cap = 140}};
+    auto const gs = mgr2.load(ss);
+
+    REQUIRE(gs.size() == 1);
+    CHECK(gs[0].eval(as) == f.eval(as));
+    CHECK(gs[0].size() == f.size());
+}
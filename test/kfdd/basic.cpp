@@ -7,7 +7,8 @@
 #include <freddy/dd/kfdd.hpp>    // kfdd_manager
 #include <freddy/expansion.hpp>  // expansion::nD
 
-#include <vector>  // std::vector
+#include <sstream>  // std::stringstream
+#include <vector>   // std::vector
 
 // *********************************************************************************************************************
 // Namespaces
@@ -569,6 +570,60 @@ TEST_CASE("kfdd basic compose test mixed", "[basic]")
     CHECK(composed.eval({true, true, true}) == true);
 }
 
+TEST_CASE("kfdd basic ite test mixed", "[basic]")
+{
+    kfdd_manager mgr;
+    auto const x0 = mgr.var(expansion::pD);
+    auto const x1 = mgr.var(expansion::nD);
+    auto const x2 = mgr.var(expansion::S);
+
+    CHECK(x0.ite(x1, mgr.zero()) == (x0 & x1));
+    CHECK(x1.ite(mgr.one(), x2) == (x1 | x2));
+    CHECK(x0.ite(x1, x2) == ((x0 & x1) | (~x0 & x2)));
+}
+
+TEST_CASE("kfdd batch evaluation test mixed", "[basic]")
+{
+    kfdd_manager mgr;
+    auto const x0 = mgr.var(expansion::pD);
+    auto const x1 = mgr.var(expansion::nD);
+    auto const x2 = mgr.var(expansion::S);
+    std::vector<kfdd> const fs{(x0 & x1) | ~x2, x0 ^ x1 ^ x2, ~x0 & x1};
+
+    auto const res = mgr.eval_batch(fs, {{0xAAAA'AAAA'AAAA'AAAA}, {0xCCCC'CCCC'CCCC'CCCC}, {0xF0F0'F0F0'F0F0'F0F0}});
+
+    for (auto i = 0uz; i < fs.size(); ++i)
+    {
+        for (auto j = 0uz; j < 64; ++j)
+        {
+            CHECK((((res[i][0] >> j) & 1u) != 0) == fs[i].eval({(j & 1) != 0, (j & 2) != 0, (j & 4) != 0}));
+        }
+    }
+}
+
+TEST_CASE("kfdd cubes test mixed", "[basic]")
+{
+    kfdd_manager mgr;
+    std::vector<kfdd> xs{mgr.var(expansion::pD), mgr.var(expansion::nD), mgr.var(expansion::S)};
+    auto const f = (xs[0] & xs[1]) | (~xs[0] & xs[2]) | (xs[1] ^ xs[2]);
+
+    auto g = mgr.zero();
+    for (auto const& c : f.cubes())
+    {
+        auto cube = mgr.one();
+        for (auto i = 0uz; i < c.size(); ++i)
+        {
+            if (c[i])
+            {
+                cube &= *c[i] ? xs[i] : ~xs[i];
+            }
+        }
+        CHECK((g & cube) == mgr.zero());
+        g |= cube;
+    }
+    CHECK(g == f);
+}
+
 TEST_CASE("restr prints", "[basic]")
 {
     kfdd_manager mgr;
@@ -602,3 +657,114 @@ TEST_CASE("compose prints", "[basic]")
     CHECK(pred2.eval({true, true, true, true, true}) == true);
     CHECK(pred2.eval({true, false, false, true, true}) == false);
 }
+
+TEST_CASE("kfdd groups are kept during DTL sifting", "[basic]")
+{
+    kfdd_manager mgr;
+    auto a0 = mgr.var(expansion::S);
+    auto b0 = mgr.var(expansion::pD);
+    auto a1 = mgr.var(expansion::S);
+    auto b1 = mgr.var(expansion::nD);
+
+    auto pred = (a0 ^ b0) | (a1 & b1);
+    mgr.group({0, 1});
+    mgr.group({2, 3});
+    mgr.dtl_sift();
+
+    CHECK(mgr.level(0) + 1 == mgr.level(1));
+    CHECK(mgr.level(2) + 1 == mgr.level(3));
+    CHECK(pred.eval({true, false, false, false}) == true);
+    CHECK(pred.eval({true, true, false, false}) == false);
+    CHECK(pred.eval({true, true, true, true}) == true);
+
+    mgr.reorder();
+
+    CHECK(mgr.level(0) + 1 == mgr.level(1));
+    CHECK(pred.eval({false, false, true, true}) == true);
+    CHECK(pred.eval({false, false, true, false}) == false);
+}
+
+TEST_CASE("kfdd DTL sifting of selected DDs keeps all DDs canonical", "[basic]")
+{
+    kfdd_manager mgr;
+    auto const x0 = mgr.var(expansion::nD), x1 = mgr.var(expansion::pD), x2 = mgr.var(expansion::nD),
+               x3 = mgr.var(expansion::pD), x4 = mgr.var(expansion::S);
+    auto const f = (x2 & x0 & ~x1) ^ (x0 & x1) ^ (x2 & ~x3);
+    auto const g = (~x2 & x1 & x3) ^ (x2 & ~x4 & ~x1) ^ (x4 & ~x0 & x3);
+    auto const h = x0 & ~x4;  // not considered
+    mgr.dtl_sift({f, g});
+
+    CHECK(f == ((x2 & x0 & ~x1) ^ (x0 & x1) ^ (x2 & ~x3)));
+    CHECK(g == ((~x2 & x1 & x3) ^ (x2 & ~x4 & ~x1) ^ (x4 & ~x0 & x3)));
+    CHECK(h == (x0 & ~x4));
+    CHECK(f.eval({true, false, true, true, false}) == true);
+    CHECK(g.eval({false, true, false, true, false}) == true);
+}
+
+TEST_CASE("kfdd decomposition types can be changed at any level", "[basic]")
+{
+    auto const ts = {expansion::S, expansion::pD, expansion::nD};
+    for (auto const t0 : ts)
+    {
+        for (auto const t1 : ts)
+        {
+            kfdd_manager mgr;
+            auto const x0 = mgr.var(expansion::S), x1 = mgr.var(expansion::pD), x2 = mgr.var(expansion::nD),
+                       x3 = mgr.var(expansion::S);
+            auto const f = (x0 & x1 & ~x3) ^ (x1 & x2) ^ (~x0 & x2 & x3);
+            auto const g = (x0 | x2) & (x1 ^ x3);
+            mgr.change_expansion_type(0, t0);  // top
+            mgr.change_expansion_type(1, t1);  // in between
+
+            kfdd_manager ref;
+            auto const y0 = ref.var(t0), y1 = ref.var(t1), y2 = ref.var(expansion::nD), y3 = ref.var(expansion::S);
+            auto const f_ref = (y0 & y1 & ~y3) ^ (y1 & y2) ^ (~y0 & y2 & y3);
+            auto const g_ref = (y0 | y2) & (y1 ^ y3);
+            mgr.gc();  // as nothing is done if the type is kept
+            ref.gc();
+
+            CHECK(mgr.node_count() == ref.node_count());
+            CHECK(f.size() == f_ref.size());
+            CHECK(g.size() == g_ref.size());
+            CHECK(f == ((x0 & x1 & ~x3) ^ (x1 & x2) ^ (~x0 & x2 & x3)));
+            CHECK(g == ((x0 | x2) & (x1 ^ x3)));
+            CHECK(f.eval({true, true, false, false}) == true);
+            CHECK(g.eval({false, false, true, true}) == true);
+        }
+    }
+}
+
+TEST_CASE("kfdd can be saved and loaded", "[basic]")
+{
+    kfdd_manager mgr;
+    auto const x0 = mgr.var(expansion::S, "x0"), x1 = mgr.var(expansion::pD, "x1"), x2 = mgr.var(expansion::nD, "x2"),
+               x3 = mgr.var(expansion::pD, "x3");
+    std::vector<kfdd> const fs{(x0 & x1) | (x2 & ~x3), x0 ^ x3, mgr.one()};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        kfdd_manager other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the same DDs")
+    {
+        CHECK(mgr.load(ss) == fs);
+    }
+}
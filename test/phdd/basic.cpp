@@ -7,6 +7,7 @@
 #include <freddy/dd/phdd.hpp>    // phdd_manager
 #include <freddy/expansion.hpp>  // expansion::S
 
+#include <sstream>  // std::stringstream
 #include <utility>  // std::pair
 #include <vector>   // std::vector
 
@@ -234,3 +235,54 @@ TEST_CASE("PHDD interprets bits numerically", "[basic]")
         CHECK(f.eval({true, true}) == 2);
     }
 }
+
+TEST_CASE("PHDD can be saved and loaded", "[basic]")
+{
+    phdd_manager mgr;
+    auto const x0 = mgr.var(expansion::pD, "x0"), x1 = mgr.var(expansion::S, "x1"), x2 = mgr.var(expansion::pD, "x2"),
+               x3 = mgr.var(expansion::S, "x3");
+    std::vector<phdd> const fs{x0 * x1 - mgr.constant(0.75) * x2 + x3, (x0 & x1) | (x2 & x3)};
+    mgr.swap(0, 2);
+    std::stringstream ss;
+    mgr.save(fs, ss);
+
+    SECTION("Functions are restored by another manager")
+    {
+        phdd_manager other;
+        auto const gs = other.load(ss);
+
+        REQUIRE(gs.size() == fs.size());
+        CHECK(other.order() == mgr.order());
+        CHECK(other.size(gs) == mgr.size(fs));
+        for (auto i = 0uz; i < fs.size(); ++i)
+        {
+            for (auto a = 0u; a < 16; ++a)
+            {
+                std::vector<bool> const as{(a & 1) != 0, (a & 2) != 0, (a & 4) != 0, (a & 8) != 0};
+
+                CHECK(fs[i].eval(as) == gs[i].eval(as));
+            }
+        }
+    }
+
+    SECTION("Loading into the same manager yields the canonical DDs")
+    {  // swapping does not renormalize the signs of the nodes it rewrites in place, so fs are rebuilt for comparison
+        std::vector<phdd> const gs{x0 * x1 - mgr.constant(0.75) * x2 + x3, (x0 & x1) | (x2 & x3)};
+
+        CHECK(mgr.load(ss) == gs);
+    }
+}
+
+TEST_CASE("PHDD multiplexes words", "[basic]")
+{
+    phdd_manager mgr;
+    auto const x0 = mgr.var(expansion::S), x1 = mgr.var(expansion::pD), x2 = mgr.var(expansion::S),
+               x3 = mgr.var(expansion::pD);
+    auto const sel = x0 | (x1 & ~x3);
+    auto const g = mgr.weighted_sum({x1, x2, x3}), h = mgr.constant(0.5) * x0 - mgr.two() * x2;
+
+    CHECK(sel.ite(g, h) == h + sel * (g - h));
+    CHECK(sel.ite(-g, -h) == -sel.ite(g, h));
+    CHECK(sel.ite(mgr.constant(5), mgr.constant(-3)) == mgr.constant(-3) + mgr.constant(8) * sel);
+    CHECK(x2.ite(sel.ite(g, h), g) == g + x2 * (h + sel * (g - h) - g));
+}